@@ -0,0 +1,163 @@
+#include "adpcm.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <format>
+#include <imaadpcm.hpp>
+#include <stdexcept>
+#include <string_view>
+
+constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+constexpr uint32_t MAX_CHANNEL_COUNT = 8;
+
+// NOTE: ブロックの先頭で予測がリセットされるので、小さいほど劣化しにくいが大きくなる。
+constexpr uint32_t BLOCK_SIZE_PER_CHANNEL = 512;
+
+uint16_t read16(std::span<const unsigned char> src, size_t offset) {
+	return static_cast<uint16_t>(src[offset] | src[offset + 1] << 8);
+}
+
+uint32_t read32(std::span<const unsigned char> src, size_t offset) {
+	return static_cast<uint32_t>(read16(src, offset)) | static_cast<uint32_t>(read16(src, offset + 2)) << 16;
+}
+
+void write16(std::vector<unsigned char> &dst, uint16_t value) {
+	dst.push_back(static_cast<unsigned char>(value));
+	dst.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+void write32(std::vector<unsigned char> &dst, uint32_t value) {
+	write16(dst, static_cast<uint16_t>(value));
+	write16(dst, static_cast<uint16_t>(value >> 16));
+}
+
+void writeFourCC(std::vector<unsigned char> &dst, std::string_view id) {
+	dst.insert(dst.end(), id.begin(), id.end());
+}
+
+bool isFourCC(std::span<const unsigned char> src, size_t offset, std::string_view id) {
+	return std::string_view(reinterpret_cast<const char *>(src.data() + offset), 4) == id;
+}
+
+struct Pcm16 {
+	uint32_t channelCount;
+	uint32_t frequency;
+	std::vector<int16_t> samples; // インターリーブ
+};
+
+Pcm16 parsePcm16(const std::string &path, std::span<const unsigned char> src) {
+	if (src.size() < 12 || !isFourCC(src, 0, "RIFF") || !isFourCC(src, 8, "WAVE")) {
+		throw std::runtime_error(std::format("'{}' is not a RIFF WAVE file.", path));
+	}
+	Pcm16 pcm{0, 0, {}};
+	size_t offset = 12;
+	while (src.size() - offset >= 8) {
+		const auto size = static_cast<size_t>(read32(src, offset + 4));
+		const auto body = offset + 8;
+		if (src.size() - body < size && !isFourCC(src, offset, "data")) {
+			break;
+		}
+		if (isFourCC(src, offset, "fmt ") && size >= 16) {
+			auto tag = read16(src, body);
+			if (tag == WAVE_FORMAT_EXTENSIBLE && size >= 40) {
+				tag = read16(src, body + 24);
+			}
+			if (tag != WAVE_FORMAT_PCM || read16(src, body + 14) != 16) {
+				throw std::runtime_error(std::format("'{}' is not a 16-bit PCM WAVE file.", path));
+			}
+			pcm.channelCount = read16(src, body + 2);
+			pcm.frequency = read32(src, body + 4);
+			if (pcm.channelCount == 0 || pcm.channelCount > MAX_CHANNEL_COUNT || pcm.frequency == 0) {
+				throw std::runtime_error(std::format("'{}' has an unsupported spec.", path));
+			}
+		} else if (isFourCC(src, offset, "data") && pcm.channelCount > 0) {
+			// NOTE: 末尾が切れているファイルもあるので、残りのサイズに丸める。
+			const auto frameSize = pcm.channelCount * 2;
+			const auto length = std::min(size, src.size() - body) / frameSize * frameSize;
+			pcm.samples.resize(length / 2);
+			for (size_t i = 0; i < pcm.samples.size(); ++i) {
+				pcm.samples[i] = static_cast<int16_t>(read16(src, body + i * 2));
+			}
+			return pcm;
+		}
+		offset = body + size + (size & 1);
+		if (offset > src.size()) {
+			break;
+		}
+	}
+	throw std::runtime_error(std::format("'{}' has no fmt or data chunk.", path));
+}
+
+// NOTE: ブロックのヘッダーには先頭サンプルをそのまま格納し、ステップ表の位置は前のブロックから引き継ぐ。
+//       末尾のブロックは短くし、最後のまとまりの余りは最後のサンプルで埋める。
+std::vector<unsigned char> encodeBlocks(const Pcm16 &pcm, uint32_t blockFrameCount) {
+	const auto cc = pcm.channelCount;
+	const auto frameCount = pcm.samples.size() / cc;
+	std::vector<ima::State> states(cc, ima::State{0, 0});
+	// NOTE: 最初のステップを最初の差分に合わせ、ステップが小さすぎて追従できない区間を避ける。
+	for (uint32_t c = 0; c < cc && frameCount > 1; ++c) {
+		const auto diff = std::abs(pcm.samples[cc + c] - pcm.samples[c]);
+		const auto it = std::lower_bound(ima::STEP_TABLE.begin(), ima::STEP_TABLE.end(), diff);
+		states[c].stepIndex = std::min(static_cast<int32_t>(it - ima::STEP_TABLE.begin()), ima::MAX_STEP_INDEX);
+	}
+	std::vector<unsigned char> data;
+	for (size_t start = 0; start < frameCount; start += blockFrameCount) {
+		const auto count = std::min<size_t>(blockFrameCount, frameCount - start);
+		const auto sample = [&](size_t frame, uint32_t c) {
+			return static_cast<int32_t>(pcm.samples[(start + std::min(frame, count - 1)) * cc + c]);
+		};
+		for (uint32_t c = 0; c < cc; ++c) {
+			states[c].predictor = sample(0, c);
+			write16(data, static_cast<uint16_t>(states[c].predictor));
+			data.push_back(static_cast<unsigned char>(states[c].stepIndex));
+			data.push_back(0);
+		}
+		for (size_t group = 0; group * 8 + 1 < count; ++group) {
+			for (uint32_t c = 0; c < cc; ++c) {
+				for (size_t k = 0; k < 8; k += 2) {
+					const auto lo = ima::encode(states[c], sample(group * 8 + k + 1, c));
+					const auto hi = ima::encode(states[c], sample(group * 8 + k + 2, c));
+					data.push_back(static_cast<unsigned char>(lo | hi << 4));
+				}
+			}
+		}
+	}
+	return data;
+}
+
+std::vector<unsigned char> encodeImaAdpcm(const std::string &path, std::span<const unsigned char> src) {
+	const auto pcm = parsePcm16(path, src);
+	const auto cc = pcm.channelCount;
+	const auto blockSize = BLOCK_SIZE_PER_CHANNEL * cc;
+	const auto blockFrameCount = ima::calcBlockFrameCount(blockSize, cc);
+	const auto frameCount = pcm.samples.size() / cc;
+	if (frameCount > UINT32_MAX) {
+		throw std::runtime_error(std::format("'{}' is too long.", path));
+	}
+	const auto data = encodeBlocks(pcm, blockFrameCount);
+
+	// RIFF WAVE (fmt, fact, dataの順)
+	std::vector<unsigned char> dst;
+	writeFourCC(dst, "RIFF");
+	write32(dst, static_cast<uint32_t>(4 + (8 + 20) + (8 + 4) + 8 + data.size()));
+	writeFourCC(dst, "WAVE");
+	writeFourCC(dst, "fmt ");
+	write32(dst, 20);
+	write16(dst, ima::WAVE_FORMAT_IMA_ADPCM);
+	write16(dst, static_cast<uint16_t>(cc));
+	write32(dst, pcm.frequency);
+	write32(dst, static_cast<uint32_t>(static_cast<uint64_t>(pcm.frequency) * blockSize / blockFrameCount));
+	write16(dst, static_cast<uint16_t>(blockSize));
+	write16(dst, 4);
+	write16(dst, 2);
+	write16(dst, static_cast<uint16_t>(blockFrameCount));
+	writeFourCC(dst, "fact");
+	write32(dst, 4);
+	write32(dst, static_cast<uint32_t>(frameCount));
+	writeFourCC(dst, "data");
+	write32(dst, static_cast<uint32_t>(data.size()));
+	dst.insert(dst.end(), data.begin(), data.end());
+	return dst;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+/// 16bit PCMのWAVEをIMA ADPCMのWAVEへ変換する関数
+///
+/// ブロックはチャンネルあたり512バイトであり、factチャンクに元のフレーム数を記録する。
+/// 16bit PCMでない場合は例外を投げる。
+/// スレッドセーフである。
+std::vector<unsigned char> encodeImaAdpcm(const std::string &path, std::span<const unsigned char> src);
@@ -0,0 +1,169 @@
+#include "atlas.hpp"
+
+#include "ingest.hpp"
+#include "pack.hpp"
+#include "parallel.hpp"
+#include "transcode.hpp"
+
+#include <algorithm>
+#include <atlasdef.hpp>
+#include <cstring>
+#include <format>
+#include <imagedef.hpp>
+#include <stdexcept>
+
+// NOTE: バイリニア補間で隣のスプライトが滲まないよう、各スプライトの周囲に端のテクセルを延ばす。
+constexpr uint32_t ATLAS_PADDING = 1;
+
+struct Placement {
+	uint32_t page;
+	PackedRect rect; // 余白を含む
+};
+
+std::map<std::string, std::vector<std::string>> extractSprites(const Options &options, std::vector<std::string> &fileNames) {
+	std::map<std::string, std::vector<std::string>> sprites;
+	if (options.atlases.empty()) {
+		return sprites;
+	}
+	std::vector<std::string> rest;
+	for (size_t i = 0; i < fileNames.size(); ++i) {
+		const auto it = findByPattern(options.atlases, fileNames[i]);
+		if (i == 0 || it == options.atlases.end()) {
+			rest.push_back(std::move(fileNames[i]));
+		} else {
+			sprites[it->second].push_back(std::move(fileNames[i]));
+		}
+	}
+	fileNames = std::move(rest);
+	return sprites;
+}
+
+void blit(const DecodedImage &src, DecodedImage &dst, uint32_t x, uint32_t y) {
+	const auto pad = static_cast<int64_t>(ATLAS_PADDING);
+	for (int64_t dy = -pad; dy < src.height + pad; ++dy) {
+		for (int64_t dx = -pad; dx < src.width + pad; ++dx) {
+			const auto sx = static_cast<size_t>(std::clamp<int64_t>(dx, 0, src.width - 1));
+			const auto sy = static_cast<size_t>(std::clamp<int64_t>(dy, 0, src.height - 1));
+			const auto s = src.pixels.data() + (sy * src.width + sx) * RAW_IMAGE_TEXEL_SIZE;
+			const auto tx = static_cast<size_t>(x + dx);
+			const auto ty = static_cast<size_t>(y + dy);
+			const auto d = dst.pixels.data() + (ty * dst.width + tx) * RAW_IMAGE_TEXEL_SIZE;
+			std::memcpy(d, s, RAW_IMAGE_TEXEL_SIZE);
+		}
+	}
+}
+
+std::vector<unsigned char> buildTable(
+	const std::vector<std::string> &paths,
+	const std::vector<DecodedImage> &images,
+	const std::vector<Placement> &placements,
+	const std::vector<DecodedImage> &pages
+) {
+	std::vector<AtlasSprite> sprites;
+	std::string strings;
+	for (size_t i = 0; i < paths.size(); ++i) {
+		const auto &p = placements[i];
+		const auto x = p.rect.x + ATLAS_PADDING;
+		const auto y = p.rect.y + ATLAS_PADDING;
+		const auto pw = static_cast<float>(pages[p.page].width);
+		const auto ph = static_cast<float>(pages[p.page].height);
+		sprites.push_back(AtlasSprite{
+			static_cast<uint32_t>(strings.size()),
+			static_cast<uint32_t>(paths[i].size()),
+			p.page,
+			x,
+			y,
+			images[i].width,
+			images[i].height,
+			static_cast<float>(x) / pw,
+			static_cast<float>(y) / ph,
+			static_cast<float>(x + images[i].width) / pw,
+			static_cast<float>(y + images[i].height) / ph,
+		});
+		strings += paths[i];
+	}
+
+	const AtlasHeader header{
+		ATLAS_MAGIC,
+		ATLAS_VERSION,
+		static_cast<uint32_t>(pages.size()),
+		static_cast<uint32_t>(sprites.size()),
+		static_cast<uint64_t>(strings.size()),
+	};
+	std::vector<unsigned char> table(sizeof(AtlasHeader) + sizeof(AtlasSprite) * sprites.size() + strings.size());
+	auto p = table.data();
+	std::memcpy(p, &header, sizeof(AtlasHeader));
+	p += sizeof(AtlasHeader);
+	std::memcpy(p, sprites.data(), sizeof(AtlasSprite) * sprites.size());
+	p += sizeof(AtlasSprite) * sprites.size();
+	std::memcpy(p, strings.data(), strings.size());
+	return table;
+}
+
+std::vector<Payload> buildAtlas(const std::string &name, const std::vector<std::string> &paths, const Options &options) {
+	// デコード
+	std::vector<DecodedImage> images(paths.size());
+	parallelFor(paths.size(), options.jobCount, [&](size_t i) {
+		images[i] = decodeImage(paths[i], loadFile(paths[i]));
+	});
+
+	// 配置
+	// NOTE: 大きいものから詰めると隙間が少なくなる。同じ大きさなら名前順にして結果を安定させる。
+	std::vector<size_t> order(paths.size());
+	for (size_t i = 0; i < order.size(); ++i) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+		const auto sa = std::max(images[a].width, images[a].height);
+		const auto sb = std::max(images[b].width, images[b].height);
+		return sa != sb ? sa > sb : paths[a] < paths[b];
+	});
+	std::vector<RectPacker> packers;
+	std::vector<Placement> placements(paths.size());
+	for (const auto i: order) {
+		const auto w = images[i].width + ATLAS_PADDING * 2;
+		const auto h = images[i].height + ATLAS_PADDING * 2;
+		uint32_t page = 0;
+		std::optional<PackedRect> rect;
+		for (; page < packers.size() && !rect; ++page) {
+			rect = packers[page].insert(w, h);
+		}
+		if (!rect) {
+			packers.emplace_back(options.atlasSize);
+			rect = packers.back().insert(w, h);
+			page = static_cast<uint32_t>(packers.size());
+		}
+		if (!rect) {
+			throw std::runtime_error(std::format("'{}' is too large for the atlas '{}'.", paths[i], name));
+		}
+		placements[i] = Placement{page - 1, *rect};
+	}
+
+	// 各ページの書込み
+	// NOTE: ページは使われた範囲に切り詰める。
+	std::vector<DecodedImage> pages(packers.size(), DecodedImage{0, 0, {}});
+	for (const auto &n: placements) {
+		pages[n.page].width = std::max(pages[n.page].width, n.rect.x + n.rect.width);
+		pages[n.page].height = std::max(pages[n.page].height, n.rect.y + n.rect.height);
+	}
+	for (auto &n: pages) {
+		n.pixels.assign(static_cast<size_t>(n.width) * n.height * RAW_IMAGE_TEXEL_SIZE, 0);
+	}
+	for (size_t i = 0; i < paths.size(); ++i) {
+		const auto &p = placements[i];
+		blit(images[i], pages[p.page], p.rect.x + ATLAS_PADDING, p.rect.y + ATLAS_PADDING);
+	}
+
+	// 格納
+	std::vector<Payload> payloads;
+	const auto add = [&](const std::string &assetName, const std::vector<unsigned char> &data) {
+		auto codec = options.selectRecipe(assetName).codec;
+		auto stored = encode(data, codec);
+		payloads.push_back(Payload{assetName, std::move(stored), codec, data.size()});
+	};
+	add(name, buildTable(paths, images, placements, pages));
+	for (size_t i = 0; i < pages.size(); ++i) {
+		add(std::format("{}.{}", name, i), buildRawImage(pages[i], false));
+	}
+	return payloads;
+}
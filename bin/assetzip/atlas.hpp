@@ -0,0 +1,18 @@
+#pragma once
+
+#include "options.hpp"
+#include "writer.hpp"
+
+#include <map>
+
+/// アトラスにまとめるスプライトを取り出す関数
+///
+/// fileNamesからスプライトを取り除き、アトラス名ごとにまとめて返す。
+/// 0番目 (configファイル) は対象外。
+std::map<std::string, std::vector<std::string>> extractSprites(const Options &options, std::vector<std::string> &fileNames);
+
+/// スプライトを一つのアトラスにまとめる関数
+///
+/// 返戻値の0番目はatlasdef.hppの形式の表 (名前はname)、以降は各ページの画像 ("<name>.<ページ番号>") である。
+/// 1ページに収まらない場合は複数のページに分ける。
+std::vector<Payload> buildAtlas(const std::string &name, const std::vector<std::string> &paths, const Options &options);
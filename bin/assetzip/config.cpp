@@ -0,0 +1,23 @@
+#include "config.hpp"
+
+#include "../../src/config/config.hpp"
+
+#include <configcompiler.hpp>
+#include <format>
+#include <stdexcept>
+#include <yaml-cpp/yaml.h>
+
+std::vector<unsigned char> compileConfig(const std::string &path, std::span<const unsigned char> src) {
+	auto blob = ConfigCompiler().compile(YAML::Load(std::string(src.begin(), src.end())));
+
+	// NOTE: orgeの解析はconst char *あるいはstd::stringを例外として投げる。
+	try {
+		const config::Document document(blob);
+		const config::Config config(config::Node(document, 0));
+	} catch (const char *e) {
+		throw std::runtime_error(std::format("'{}': {}", path, e));
+	} catch (const std::string &e) {
+		throw std::runtime_error(std::format("'{}': {}", path, e));
+	}
+	return blob;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+/// configファイルをconfigdef.hppの形式へ変換する関数
+///
+/// 変換結果をorgeと同じ解析にかけ、configが不正なら例外を投げる。
+/// スレッドセーフである。
+std::vector<unsigned char> compileConfig(const std::string &path, std::span<const unsigned char> src);
@@ -0,0 +1,100 @@
+#include "ingest.hpp"
+
+#include "adpcm.hpp"
+#include "config.hpp"
+#include "spirv.hpp"
+#include "transcode.hpp"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <lz4.hpp>
+#include <stdexcept>
+
+std::vector<unsigned char> loadFile(const std::string &path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error(std::format("failed to load '{}'.", path));
+	}
+
+	file.seekg(0, std::ios::end);
+	size_t size = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	std::vector<unsigned char> data(size);
+	file.read(reinterpret_cast<char*>(data.data()), size);
+
+	return data;
+}
+
+std::vector<unsigned char> encode(const std::vector<unsigned char> &data, AssetCodec &codec) {
+	switch (codec) {
+	case AssetCodec::Lz4: {
+		auto compressed = lz4::compress(data);
+		if (compressed.size() < data.size()) {
+			return compressed;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	// NOTE: 圧縮しても小さくならない場合は無圧縮で格納する。
+	codec = AssetCodec::None;
+	return data;
+}
+
+int64_t getModifiedTime(const std::string &path) {
+	std::error_code ec;
+	const auto time = std::filesystem::last_write_time(path, ec);
+	return ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+Ingested ingest(const std::string &path, const Recipe &recipe, const Manifest &manifest, const PreviousArchive &previous) {
+	const auto description = recipe.describe();
+	const auto mtime = getModifiedTime(path);
+	const auto it = manifest.find(path);
+	const auto old = it != manifest.end() && it->second.recipe == description ? &it->second : nullptr;
+
+	// サイズと更新日時が一致すれば、読み込まずに使い回す
+	std::error_code ec;
+	const auto size = std::filesystem::file_size(path, ec);
+	if (old && !ec && old->size == size && old->mtime == mtime) {
+		if (auto payload = previous.load(path)) {
+			return Ingested{std::move(*payload), *old, true, recipe.stripSpirv};
+		}
+	}
+
+	// 内容が一致すれば、変換せずに使い回す
+	const auto data = loadFile(path);
+	ManifestRecord record{static_cast<uint64_t>(data.size()), mtime, hashContent(data), description};
+	if (old && old->size == record.size && old->hash == record.hash) {
+		if (auto payload = previous.load(path)) {
+			return Ingested{std::move(*payload), std::move(record), true, recipe.stripSpirv};
+		}
+	}
+
+	// 変換 & 圧縮
+	auto codec = recipe.codec;
+	if (recipe.rawImage) {
+		const auto image = transcodeImage(path, data, recipe.mipmaps);
+		auto stored = encode(image, codec);
+		return Ingested{Payload{path, std::move(stored), codec, image.size()}, std::move(record), false, false};
+	}
+	if (recipe.stripSpirv) {
+		const auto module = stripSpirv(path, data);
+		auto stored = encode(module, codec);
+		return Ingested{Payload{path, std::move(stored), codec, module.size()}, std::move(record), false, true};
+	}
+	if (recipe.imaAdpcm) {
+		const auto wave = encodeImaAdpcm(path, data);
+		auto stored = encode(wave, codec);
+		return Ingested{Payload{path, std::move(stored), codec, wave.size()}, std::move(record), false, false};
+	}
+	if (recipe.compileConfig) {
+		const auto blob = compileConfig(path, data);
+		return Ingested{Payload{path, blob, codec, blob.size()}, std::move(record), false, false};
+	}
+	auto stored = encode(data, codec);
+	return Ingested{Payload{path, std::move(stored), codec, record.size}, std::move(record), false, false};
+}
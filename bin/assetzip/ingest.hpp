@@ -0,0 +1,26 @@
+#pragma once
+
+#include "manifest.hpp"
+#include "options.hpp"
+#include "previous.hpp"
+#include "writer.hpp"
+
+std::vector<unsigned char> loadFile(const std::string &path);
+
+/// codecで圧縮する関数
+///
+/// 圧縮しても小さくならない場合は無圧縮のまま返し、codecをAssetCodec::Noneにする。
+std::vector<unsigned char> encode(const std::vector<unsigned char> &data, AssetCodec &codec);
+
+struct Ingested {
+	Payload payload;
+	ManifestRecord record;
+	bool reused;   // 前回の.datのデータを使い回したか
+	bool stripped; // SPIR-Vからデバッグ情報などを取り除いたか
+};
+
+/// 入力ファイルを読み込み、recipeに従って格納する形式へ変換する関数
+///
+/// manifestに記録された前回の状態から変更がなければ、previousに格納済みのデータを使い回す。
+/// スレッドセーフである。
+Ingested ingest(const std::string &path, const Recipe &recipe, const Manifest &manifest, const PreviousArchive &previous);
@@ -1,5 +1,10 @@
-#include <assetdef.hpp>
-#include <fstream>
+#include "atlas.hpp"
+#include "config.hpp"
+#include "ingest.hpp"
+#include "options.hpp"
+#include "parallel.hpp"
+#include "trace.hpp"
+
 #include <format>
 #include <iostream>
 #include <set>
@@ -34,70 +39,109 @@ std::vector<std::string> parseAssetFileNames(const std::string &yamlFilePath) {
 	return paths;
 }
 
-std::vector<unsigned char> loadFile(const std::string &path) {
-	std::ifstream file(path, std::ios::binary);
-	if (!file) {
-		throw std::runtime_error(std::format("failed to load '{}'.", path));
-	}
-
-	file.seekg(0, std::ios::end);
-	size_t size = file.tellg();
-	file.seekg(0, std::ios::beg);
-
-	std::vector<unsigned char> data(size);
-	file.read(reinterpret_cast<char*>(data.data()), size);
-
-	return data;
-}
-
-void run(const std::string &yamlFilePath) {
-	const auto fileNames = parseAssetFileNames(yamlFilePath);
+void run(const Options &options) {
+	auto fileNames = parseAssetFileNames(options.configPath);
 	if (fileNames.empty()) {
 		throw std::runtime_error("no asset files specified in config.");
 	}
-
-	// .dat出力開始
-	std::ofstream out(".dat", std::ios::binary);
-	if (!out) {
-		throw std::runtime_error("failed to create '.dat'.");
+	// NOTE: 変換する場合は読込み時に検証されるので、YAMLのまま格納する場合のみここで検証する。
+	if (options.yamlConfig) {
+		compileConfig(options.configPath, loadFile(options.configPath));
+	}
+	const auto sprites = extractSprites(options, fileNames);
+	const auto trace = options.tracePath.empty() ? std::vector<std::string>() : loadTrace(options.tracePath);
+
+	// 前回の状態読込み
+	// NOTE: 書込み時に上書きされるので、それまでに前回の.datから必要なデータを読み切る。
+	const auto manifestPath = options.outputPath + ".manifest";
+	Manifest manifest;
+	PreviousArchive previous;
+	if (options.incremental) {
+		manifest = loadManifest(manifestPath);
+		previous = PreviousArchive(options.outputPath);
 	}
 
-	// ヘッダー書込み
-	const AssetHeader header{static_cast<uint32_t>(fileNames.size())};
-	out.write(reinterpret_cast<const char *>(&header), sizeof(AssetHeader));
-
-	// エントリーは後回し
-	const auto entriesPos = out.tellp();
-	std::vector<char> placeholder(sizeof(AssetEntry) * fileNames.size(), 0);
-	out.write(placeholder.data(), placeholder.size());
+	// 読込み & 圧縮
+	// NOTE: configファイルは常に無圧縮で格納する。
+	std::vector<Ingested> ingested(fileNames.size());
+	parallelFor(fileNames.size(), options.jobCount, [&](size_t i) {
+		const auto recipe = i == 0 ? Recipe{.compileConfig = !options.yamlConfig} : options.selectRecipe(fileNames[i]);
+		ingested[i] = ingest(fileNames[i], recipe, manifest, previous);
+	});
+
+	std::vector<Payload> payloads;
+	std::vector<ManifestRecord> records;
+	uint64_t rawSize = 0;
+	size_t reusedCount = 0;
+	size_t strippedCount = 0;
+	uint64_t shaderSize = 0;
+	uint64_t strippedShaderSize = 0;
+	for (auto &n: ingested) {
+		rawSize += n.payload.originalSize;
+		reusedCount += n.reused ? 1 : 0;
+		if (n.stripped) {
+			strippedCount += 1;
+			shaderSize += n.record.size;
+			strippedShaderSize += n.payload.originalSize;
+		}
+		payloads.push_back(std::move(n.payload));
+		records.push_back(std::move(n.record));
+	}
 
-	// データ書込み & エントリー構築
-	std::vector<AssetEntry> entries;
-	for (size_t i = 0; i < fileNames.size(); ++i) {
-		const auto data = loadFile(fileNames[i]);
-		entries.emplace_back(
-			static_cast<uint32_t>(i),
-			static_cast<uint32_t>(out.tellp()),
-			static_cast<uint32_t>(data.size())
-		);
-		out.write(reinterpret_cast<const char *>(data.data()), data.size());
+	// アトラス構築
+	// NOTE: アトラスは複数のファイルから作られるので、差分ビルドでも毎回作り直す。
+	std::set<std::string> names(fileNames.begin(), fileNames.end());
+	size_t spriteCount = 0;
+	for (const auto &[name, paths]: sprites) {
+		for (auto &n: buildAtlas(name, paths, options)) {
+			if (!names.emplace(n.name).second) {
+				throw std::runtime_error(std::format("the atlas '{}' conflicts with the asset '{}'.", name, n.name));
+			}
+			rawSize += n.originalSize;
+			payloads.push_back(std::move(n));
+		}
+		spriteCount += paths.size();
 	}
 
-	// エントリー書込み
-	out.seekp(entriesPos);
-	out.write(reinterpret_cast<const char *>(entries.data()), sizeof(AssetEntry) * entries.size());
+	// 書込み
+	const auto result = writeArchive(options.outputPath, payloads, planLayout(payloads, trace), options.alignment);
+	if (options.incremental) {
+		saveManifest(manifestPath, fileNames, records);
+	}
 
-	std::cout << "successfully zipped " << fileNames.size() - 1 << " assets." << std::endl;
+	std::cout << "successfully zipped " << payloads.size() - 1 << " assets." << std::endl;
+	std::cout << std::format("archive size: {} bytes (assets: {} bytes)", result.archiveSize, rawSize) << std::endl;
+	if (result.dedupCount > 0) {
+		std::cout << std::format("deduplicated {} assets ({} bytes saved)", result.dedupCount, result.dedupSize) << std::endl;
+	}
+	if (!sprites.empty()) {
+		std::cout << std::format("packed {} sprites into {} atlases", spriteCount, sprites.size()) << std::endl;
+	}
+	if (strippedCount > 0) {
+		std::cout << std::format(
+			"stripped {} shaders: {} bytes -> {} bytes",
+			strippedCount,
+			shaderSize,
+			strippedShaderSize
+		) << std::endl;
+	}
+	if (options.incremental) {
+		std::cout << std::format("reused {} of {} files from the previous build", reusedCount, fileNames.size()) << std::endl;
+	}
 }
 
 int main(int argc, char *argv[]) {
-	if (argc != 2) {
-		std::cerr << "usage: assetzip <config-file-path>" << std::endl;
+	Options options;
+	try {
+		options = parseOptions(argc, argv);
+	} catch (const std::exception &e) {
+		std::cerr << e.what() << std::endl;
+		std::cerr << USAGE << std::endl;
 		return 1;
 	}
 
 	try {
-		run(argv[1]);
+		run(options);
 	} catch (const YAML::Exception &e) {
 		std::cerr << e.what() << std::endl;
 		std::cerr << "failed to zip asset files." << std::endl;
@@ -0,0 +1,52 @@
+#include "manifest.hpp"
+
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+// NOTE: 一行目がこれと一致しないマニフェストは無視する。
+const char *const MANIFEST_SIGNATURE = "assetzip-manifest 1";
+
+Manifest loadManifest(const std::string &path) {
+	std::ifstream file(path);
+	std::string line;
+	if (!file || !std::getline(file, line) || line != MANIFEST_SIGNATURE) {
+		return {};
+	}
+
+	// 各行は "<size> <mtime> <hash> <recipe> <path>"
+	Manifest manifest;
+	while (std::getline(file, line)) {
+		std::istringstream ss(line);
+		ManifestRecord record;
+		std::string file;
+		if (!(ss >> record.size >> record.mtime >> record.hash >> record.recipe) || ss.get() != ' ') {
+			return {};
+		}
+		std::getline(ss, file);
+		manifest.emplace(std::move(file), std::move(record));
+	}
+	return manifest;
+}
+
+void saveManifest(const std::string &path, const std::vector<std::string> &files, const std::vector<ManifestRecord> &records) {
+	std::ofstream file(path);
+	file << MANIFEST_SIGNATURE << '\n';
+	for (size_t i = 0; i < files.size(); ++i) {
+		const auto &n = records[i];
+		file << std::format("{} {} {} {} {}\n", n.size, n.mtime, n.hash, n.recipe, files[i]);
+	}
+	if (!file) {
+		throw std::runtime_error(std::format("failed to write '{}'.", path));
+	}
+}
+
+uint64_t hashContent(std::span<const unsigned char> data) noexcept {
+	uint64_t hash = 14695981039346656037ull;
+	for (const auto n: data) {
+		hash ^= n;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// 差分ビルドのために入力ファイルごとに記録する情報
+struct ManifestRecord {
+	uint64_t size;
+	int64_t mtime;
+	uint64_t hash;      // 入力ファイルの内容のハッシュ
+	std::string recipe; // 格納時の処理内容 (圧縮形式など)
+};
+
+// キーは入力ファイルのパス
+using Manifest = std::unordered_map<std::string, ManifestRecord>;
+
+/// マニフェストを読み込む関数
+///
+/// 存在しない場合や形式が異なる場合は空のマニフェストを返す。
+Manifest loadManifest(const std::string &path);
+
+void saveManifest(const std::string &path, const std::vector<std::string> &files, const std::vector<ManifestRecord> &records);
+
+// FNV-1a (64bit)
+uint64_t hashContent(std::span<const unsigned char> data) noexcept;
@@ -0,0 +1,160 @@
+#include "options.hpp"
+
+#include <charconv>
+#include <configdef.hpp>
+#include <format>
+#include <stdexcept>
+#include <string_view>
+
+const char *const USAGE =
+	"usage: assetzip [options] <config-file-path>\n"
+	"options:\n"
+	"  --codec <pattern>=<codec>  compress assets matching <pattern> with <codec>.\n"
+	"                             <pattern> is a file path, an extension (e.g. '.png') or '*'.\n"
+	"                             <codec> is 'none' or 'lz4'.\n"
+	"  --alignment <bytes>        align each payload to <bytes> (a power of two, 4 or more; default 16).\n"
+	"  --output <path>            write the archive to <path> (default '.dat').\n"
+	"                             name patch archives '.dat.1', '.dat.2', ... to overlay the base one.\n"
+	"  --jobs <n>                 process files on <n> threads (default: the number of logical cores).\n"
+	"  --incremental              reuse unchanged files from the previous build.\n"
+	"                             their states are recorded in '<output>.manifest'.\n"
+	"  --raw-image <pattern>      decode images matching <pattern> at build time\n"
+	"                             so that they are uploaded without decoding at runtime.\n"
+	"  --mipmaps                  generate mipmaps for images decoded at build time.\n"
+	"  --atlas <pattern>=<name>   pack images matching <pattern> into the sprite atlas <name>.\n"
+	"                             the pages are stored as '<name>.0', '<name>.1', ...\n"
+	"  --atlas-size <pixels>      the maximum width and height of an atlas page (default 2048).\n"
+	"  --trace <path>             lay out payloads in the order recorded by orge ('asset-trace' in config).\n"
+	"  --strip-spirv              strip debug and reflection info from '.spv' shaders.\n"
+	"  --adpcm <pattern>          encode 16-bit PCM WAVE files matching <pattern> to IMA ADPCM (4 bits per sample).\n"
+	"                             orge decodes them while playing.\n"
+	"  --yaml-config              store the config file as YAML instead of the precompiled binary form.";
+
+AssetCodec parseCodec(std::string_view s) {
+	if (s == "none") {
+		return AssetCodec::None;
+	} else if (s == "lz4") {
+		return AssetCodec::Lz4;
+	} else {
+		throw std::runtime_error(std::format("unknown codec '{}'.", s));
+	}
+}
+
+uint64_t parseAlignment(std::string_view s) {
+	uint64_t alignment = 0;
+	const auto [p, e] = std::from_chars(s.data(), s.data() + s.size(), alignment);
+	if (e != std::errc{} || p != s.data() + s.size() || alignment < 4 || (alignment & (alignment - 1)) != 0) {
+		throw std::runtime_error(std::format("alignment must be a power of two and 4 or more but passed '{}'.", s));
+	}
+	return alignment;
+}
+
+uint32_t parseAtlasSize(std::string_view s) {
+	uint32_t size = 0;
+	const auto [p, e] = std::from_chars(s.data(), s.data() + s.size(), size);
+	if (e != std::errc{} || p != s.data() + s.size() || size == 0 || size > MAX_ATLAS_SIZE) {
+		throw std::runtime_error(std::format("atlas size must be between 1 and {} but passed '{}'.", MAX_ATLAS_SIZE, s));
+	}
+	return size;
+}
+
+uint32_t parseJobCount(std::string_view s) {
+	uint32_t count = 0;
+	const auto [p, e] = std::from_chars(s.data(), s.data() + s.size(), count);
+	if (e != std::errc{} || p != s.data() + s.size() || count == 0) {
+		throw std::runtime_error(std::format("the number of jobs must be a positive integer but passed '{}'.", s));
+	}
+	return count;
+}
+
+std::string Recipe::describe() const {
+	auto s = std::string(codec == AssetCodec::Lz4 ? "lz4" : "none");
+	if (rawImage) {
+		s += mipmaps ? "+raw-image-mipmaps" : "+raw-image";
+	}
+	if (stripSpirv) {
+		s += "+strip-spirv";
+	}
+	if (imaAdpcm) {
+		s += "+ima-adpcm";
+	}
+	if (compileConfig) {
+		s += std::format("+config-blob{}", CONFIG_BLOB_VERSION);
+	}
+	return s;
+}
+
+Recipe Options::selectRecipe(const std::string &path) const {
+	Recipe recipe;
+	if (const auto it = findByPattern(codecs, path); it != codecs.end()) {
+		recipe.codec = it->second;
+	}
+	recipe.rawImage = findByPattern(rawImages, path) != rawImages.end();
+	recipe.mipmaps = recipe.rawImage && mipmaps;
+	recipe.stripSpirv = stripSpirv && std::filesystem::path(path).extension() == ".spv";
+	// NOTE: orgeは拡張子で形式を判断するので、WAVEの拡張子のものに限る。
+	const auto extension = std::filesystem::path(path).extension();
+	const auto wave = extension == ".wav" || extension == ".wave" || extension == ".WAV" || extension == ".WAVE";
+	recipe.imaAdpcm = wave && findByPattern(imaAdpcmWaves, path) != imaAdpcmWaves.end();
+	return recipe;
+}
+
+Options parseOptions(int argc, char *argv[]) {
+	Options options;
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg(argv[i]);
+		const auto next = [&]() {
+			if (i + 1 >= argc) {
+				throw std::runtime_error(std::format("'{}' requires an argument.", arg));
+			}
+			return std::string_view(argv[++i]);
+		};
+		if (arg == "--codec") {
+			const auto value = next();
+			const auto eq = value.rfind('=');
+			if (eq == std::string_view::npos || eq == 0) {
+				throw std::runtime_error(std::format("'{}' is not in the form of <pattern>=<codec>.", value));
+			}
+			options.codecs[std::string(value.substr(0, eq))] = parseCodec(value.substr(eq + 1));
+		} else if (arg == "--alignment") {
+			options.alignment = parseAlignment(next());
+		} else if (arg == "--output") {
+			options.outputPath = next();
+		} else if (arg == "--jobs") {
+			options.jobCount = parseJobCount(next());
+		} else if (arg == "--incremental") {
+			options.incremental = true;
+		} else if (arg == "--raw-image") {
+			options.rawImages.emplace(next());
+		} else if (arg == "--mipmaps") {
+			options.mipmaps = true;
+		} else if (arg == "--atlas") {
+			const auto value = next();
+			const auto eq = value.rfind('=');
+			if (eq == std::string_view::npos || eq == 0 || eq + 1 == value.size()) {
+				throw std::runtime_error(std::format("'{}' is not in the form of <pattern>=<name>.", value));
+			}
+			options.atlases[std::string(value.substr(0, eq))] = value.substr(eq + 1);
+		} else if (arg == "--atlas-size") {
+			options.atlasSize = parseAtlasSize(next());
+		} else if (arg == "--trace") {
+			options.tracePath = next();
+		} else if (arg == "--adpcm") {
+			options.imaAdpcmWaves.emplace(next());
+		} else if (arg == "--strip-spirv") {
+			options.stripSpirv = true;
+		} else if (arg == "--yaml-config") {
+			options.yamlConfig = true;
+		} else if (arg.starts_with("--")) {
+			throw std::runtime_error(std::format("unknown option '{}'.", arg));
+		} else if (options.configPath.empty()) {
+			options.configPath = arg;
+		} else {
+			throw std::runtime_error("too many config files specified.");
+		}
+	}
+	if (options.configPath.empty()) {
+		throw std::runtime_error("no config file specified.");
+	}
+	return options;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <assetdef.hpp>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+/// 入力ファイルを格納する際の処理内容
+struct Recipe {
+	AssetCodec codec = AssetCodec::None;
+	bool rawImage = false;      // imagedef.hppの形式へ変換するか
+	bool mipmaps = false;       // 変換時にミップチェーンを生成するか
+	bool compileConfig = false; // configdef.hppの形式へ変換するか
+	bool stripSpirv = false;    // SPIR-Vからデバッグ情報などを取り除くか
+	bool imaAdpcm = false;      // WAVEをIMA ADPCMへ変換するか
+
+	/// 差分ビルドで処理内容の変化を検出するための文字列
+	std::string describe() const;
+};
+
+struct Options {
+	std::string configPath;
+
+	std::string outputPath = ".dat";
+
+	// 並列数 (既定では論理コア数)
+	uint32_t jobCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+	// 前回のビルドから変更のないファイルを使い回すか
+	bool incremental = false;
+
+	// 各データの先頭を揃える境界 (2の累乗かつ4以上)
+	uint64_t alignment = 16;
+
+	// キーはファイルパス・拡張子 (".png"など)・"*"のいずれか
+	std::unordered_map<std::string, AssetCodec> codecs;
+
+	// 同上
+	std::unordered_set<std::string> rawImages;
+
+	bool mipmaps = false;
+
+	// キーは同上、値はアトラス名
+	std::unordered_map<std::string, std::string> atlases;
+
+	// アトラスの1ページの最大の幅・高さ
+	uint32_t atlasSize = 2048;
+
+	// orgeが記録したアセットの参照順 (configのasset-trace) のパス
+	std::string tracePath;
+
+	// キーは同上。該当するWAVEをIMA ADPCMへ変換する
+	std::unordered_set<std::string> imaAdpcmWaves;
+
+	// .spvファイルからデバッグ情報などを取り除くか
+	bool stripSpirv = false;
+
+	// configをバイナリ表現へ変換せずYAMLのまま格納するか
+	bool yamlConfig = false;
+
+	Recipe selectRecipe(const std::string &path) const;
+};
+
+// NOTE: GPUが対応する最大のイメージサイズとして一般的な値。
+constexpr uint32_t MAX_ATLAS_SIZE = 16384;
+
+extern const char *const USAGE;
+
+Options parseOptions(int argc, char *argv[]);
+
+// NOTE: ファイルパス・拡張子・"*"の順に探す。
+template<typename T>
+auto findByPattern(const T &patterns, const std::string &path) {
+	if (const auto it = patterns.find(path); it != patterns.end()) {
+		return it;
+	}
+	if (const auto it = patterns.find(std::filesystem::path(path).extension().string()); it != patterns.end()) {
+		return it;
+	}
+	return patterns.find("*");
+}
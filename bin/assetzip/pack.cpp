@@ -0,0 +1,84 @@
+#include "pack.hpp"
+
+#include <algorithm>
+#include <limits>
+
+bool contains(const PackedRect &a, const PackedRect &b) {
+	return b.x >= a.x && b.y >= a.y && b.x + b.width <= a.x + a.width && b.y + b.height <= a.y + a.height;
+}
+
+bool intersects(const PackedRect &a, const PackedRect &b) {
+	return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+// NOTE: usedと重なる空き領域を、usedの上下左右に残る部分へ分割する。
+void RectPacker::_split(const PackedRect &used) {
+	std::vector<PackedRect> next;
+	for (const auto &n: _free) {
+		if (!intersects(n, used)) {
+			next.push_back(n);
+			continue;
+		}
+		if (used.x > n.x) {
+			next.push_back(PackedRect{n.x, n.y, used.x - n.x, n.height});
+		}
+		if (used.x + used.width < n.x + n.width) {
+			const auto x = used.x + used.width;
+			next.push_back(PackedRect{x, n.y, n.x + n.width - x, n.height});
+		}
+		if (used.y > n.y) {
+			next.push_back(PackedRect{n.x, n.y, n.width, used.y - n.y});
+		}
+		if (used.y + used.height < n.y + n.height) {
+			const auto y = used.y + used.height;
+			next.push_back(PackedRect{n.x, y, n.width, n.y + n.height - y});
+		}
+	}
+	_free = std::move(next);
+}
+
+// NOTE: 他の空き領域に含まれる空き領域は冗長なので取り除く。
+void RectPacker::_prune() {
+	for (size_t i = 0; i < _free.size(); ++i) {
+		for (size_t j = i + 1; j < _free.size(); ++j) {
+			if (contains(_free[j], _free[i])) {
+				_free.erase(_free.begin() + static_cast<std::ptrdiff_t>(i));
+				i -= 1;
+				break;
+			}
+			if (contains(_free[i], _free[j])) {
+				_free.erase(_free.begin() + static_cast<std::ptrdiff_t>(j));
+				j -= 1;
+			}
+		}
+	}
+}
+
+std::optional<PackedRect> RectPacker::insert(uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0 || width > _size || height > _size) {
+		return std::nullopt;
+	}
+
+	std::optional<PackedRect> best;
+	auto bestShort = std::numeric_limits<uint32_t>::max();
+	auto bestLong = std::numeric_limits<uint32_t>::max();
+	for (const auto &n: _free) {
+		if (n.width < width || n.height < height) {
+			continue;
+		}
+		const auto dw = n.width - width;
+		const auto dh = n.height - height;
+		const auto s = std::min(dw, dh);
+		const auto l = std::max(dw, dh);
+		if (s < bestShort || (s == bestShort && l < bestLong)) {
+			best = PackedRect{n.x, n.y, width, height};
+			bestShort = s;
+			bestLong = l;
+		}
+	}
+	if (best) {
+		_split(*best);
+		_prune();
+	}
+	return best;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+struct PackedRect {
+	uint32_t x;
+	uint32_t y;
+	uint32_t width;
+	uint32_t height;
+};
+
+/// 正方形の領域に矩形を詰めるクラス
+///
+/// MaxRects法 (Best Short Side Fit) を用いる。
+/// 空き領域を互いに重なり得る極大な矩形の集合として保持し、
+/// 配置後に残る短辺が最も短くなる位置を選ぶ。
+class RectPacker {
+private:
+	uint32_t _size;
+	std::vector<PackedRect> _free;
+
+	void _split(const PackedRect &used);
+	void _prune();
+
+public:
+	RectPacker(uint32_t size): _size(size), _free{PackedRect{0, 0, size, size}} {}
+
+	/// 矩形を配置する関数
+	///
+	/// 配置できない場合はstd::nulloptを返す。
+	std::optional<PackedRect> insert(uint32_t width, uint32_t height);
+};
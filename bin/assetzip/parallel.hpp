@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// f(0), f(1), ..., f(count - 1)をthreadCount個のスレッドで並列に呼ぶ関数
+///
+/// 例外が発生した場合、以降の呼出しを打ち切って最初の例外を再送出する。
+inline void parallelFor(size_t count, uint32_t threadCount, const std::function<void(size_t)> &f) {
+	std::atomic<size_t> next = 0;
+	std::atomic<bool> failed = false;
+	std::exception_ptr error;
+	std::mutex mutex;
+
+	const auto work = [&]() {
+		for (auto i = next++; i < count && !failed; i = next++) {
+			try {
+				f(i);
+			} catch (...) {
+				const std::lock_guard<std::mutex> lock(mutex);
+				if (!error) {
+					error = std::current_exception();
+				}
+				failed = true;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	const auto n = std::min<size_t>(std::max<uint32_t>(threadCount, 1), count);
+	for (size_t i = 1; i < n; ++i) {
+		threads.emplace_back(work);
+	}
+	work();
+	for (auto &n: threads) {
+		n.join();
+	}
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
@@ -0,0 +1,58 @@
+#include "previous.hpp"
+
+#include <fstream>
+
+template<typename T>
+bool readAt(std::ifstream &file, uint64_t offset, T *dst, size_t count) {
+	file.seekg(static_cast<std::streamoff>(offset));
+	file.read(reinterpret_cast<char *>(dst), static_cast<std::streamsize>(sizeof(T) * count));
+	return static_cast<bool>(file);
+}
+
+PreviousArchive::PreviousArchive(const std::string &path): _path(path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return;
+	}
+	file.seekg(0, std::ios::end);
+	const auto size = static_cast<uint64_t>(file.tellg());
+
+	AssetHeader header;
+	if (!readAt(file, 0, &header, 1) || header.magic != ASSET_MAGIC || header.version != ASSET_VERSION) {
+		return;
+	}
+	if (sizeof(AssetEntry) * header.count > size - sizeof(AssetHeader)) {
+		return;
+	}
+	std::vector<AssetEntry> entries(header.count);
+	if (!readAt(file, sizeof(AssetHeader), entries.data(), entries.size())) {
+		return;
+	}
+
+	for (const auto &n: entries) {
+		if (n.offset > size || n.size > size - n.offset || n.nameOffset > size || n.nameSize > size - n.nameOffset) {
+			continue;
+		}
+		std::string name(n.nameSize, '\0');
+		if (!readAt(file, n.nameOffset, name.data(), name.size())) {
+			return;
+		}
+		_entries.emplace(std::move(name), n);
+	}
+}
+
+std::optional<Payload> PreviousArchive::load(const std::string &name) const {
+	const auto it = _entries.find(name);
+	if (it == _entries.end()) {
+		return std::nullopt;
+	}
+	const auto &entry = it->second;
+
+	// NOTE: 並列に呼ばれるので、呼出しごとにファイルを開く。
+	std::ifstream file(_path, std::ios::binary);
+	std::vector<unsigned char> data(entry.size);
+	if (!file || !readAt(file, entry.offset, data.data(), data.size())) {
+		return std::nullopt;
+	}
+	return Payload{name, std::move(data), entry.codec, entry.originalSize};
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "writer.hpp"
+
+#include <optional>
+#include <unordered_map>
+
+/// 前回書き出した.datから格納済みのデータを取り出すクラス
+///
+/// 差分ビルドで、変更のないファイルを読み直したり圧縮し直したりせずに済ませるために用いる。
+class PreviousArchive {
+private:
+	std::string _path;
+	std::unordered_map<std::string, AssetEntry> _entries;
+
+public:
+	PreviousArchive() = default;
+
+	/// NOTE: 読めない場合や形式が異なる場合は空になる。
+	explicit PreviousArchive(const std::string &path);
+
+	/// 格納済みのデータを取り出す関数
+	///
+	/// 存在しない場合はstd::nulloptを返す。
+	/// スレッドセーフである。
+	std::optional<Payload> load(const std::string &name) const;
+};
@@ -0,0 +1,120 @@
+#include "spirv.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_set>
+
+constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+constexpr size_t SPIRV_HEADER_WORD_COUNT = 5;
+
+enum class Op: uint16_t {
+	SourceContinued = 2,
+	Source = 3,
+	SourceExtension = 4,
+	Name = 5,
+	MemberName = 6,
+	String = 7,
+	Line = 8,
+	Extension = 10,
+	ExtInstImport = 11,
+	ExtInst = 12,
+	NoLine = 317,
+	ModuleProcessed = 330,
+	DecorateId = 332,
+	ExtInstWithForwardRefsKHR = 4433,
+	DecorateString = 5632,
+	MemberDecorateString = 5633,
+};
+
+constexpr uint32_t DECORATION_HLSL_COUNTER_BUFFER_GOOGLE = 5634;
+constexpr uint32_t DECORATION_USER_SEMANTIC = 5635;
+constexpr uint32_t DECORATION_USER_TYPE_GOOGLE = 5636;
+
+// NOTE: リテラル文字列はnull終端され、4バイト単位で詰められている。
+std::string_view readLiteral(std::span<const uint32_t> words) {
+	const auto s = std::string_view(reinterpret_cast<const char *>(words.data()), words.size() * sizeof(uint32_t));
+	return s.substr(0, s.find('\0'));
+}
+
+bool isDebugInstruction(Op op) {
+	switch (op) {
+	case Op::SourceContinued:
+	case Op::Source:
+	case Op::SourceExtension:
+	case Op::Name:
+	case Op::MemberName:
+	case Op::String:
+	case Op::Line:
+	case Op::NoLine:
+	case Op::ModuleProcessed:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// NOTE: OpenCL.DebugInfo.100とDebugInfoはNonSemanticではないが、OpStringを参照するデバッグ専用の命令セットである。
+bool isDebugInstructionSet(std::string_view name) {
+	return name.starts_with("NonSemantic.") || name == "OpenCL.DebugInfo.100" || name == "DebugInfo";
+}
+
+bool isReflectionInstruction(Op op, std::span<const uint32_t> words) {
+	switch (op) {
+	case Op::DecorateId:
+		return words.size() >= 3 && words[2] == DECORATION_HLSL_COUNTER_BUFFER_GOOGLE;
+	case Op::DecorateString:
+		return words.size() >= 3 && (words[2] == DECORATION_USER_SEMANTIC || words[2] == DECORATION_USER_TYPE_GOOGLE);
+	case Op::MemberDecorateString:
+		return words.size() >= 4 && (words[3] == DECORATION_USER_SEMANTIC || words[3] == DECORATION_USER_TYPE_GOOGLE);
+	case Op::Extension: {
+		const auto name = readLiteral(words.subspan(1));
+		return name == "SPV_GOOGLE_hlsl_functionality1" || name == "SPV_GOOGLE_user_type";
+	}
+	default:
+		return false;
+	}
+}
+
+std::vector<unsigned char> stripSpirv(const std::string &path, std::span<const unsigned char> src) {
+	if (src.size() % sizeof(uint32_t) != 0 || src.size() < SPIRV_HEADER_WORD_COUNT * sizeof(uint32_t)) {
+		throw std::runtime_error(std::format("'{}' is not a SPIR-V module.", path));
+	}
+	std::vector<uint32_t> words(src.size() / sizeof(uint32_t));
+	std::memcpy(words.data(), src.data(), src.size());
+	if (words[0] != SPIRV_MAGIC) {
+		throw std::runtime_error(std::format("'{}' is not a little-endian SPIR-V module.", path));
+	}
+
+	// NOTE: デバッグ用の拡張命令の結果はデバッグ用の拡張命令からしか参照されないので、まとめて取り除ける。
+	//       これらはOpStringを参照するため、OpStringを取り除くなら必ず一緒に取り除かなければならない。
+	std::unordered_set<uint32_t> debugSets;
+	std::vector<uint32_t> stripped(words.begin(), words.begin() + SPIRV_HEADER_WORD_COUNT);
+	for (size_t i = SPIRV_HEADER_WORD_COUNT; i < words.size();) {
+		const auto wordCount = words[i] >> 16;
+		const auto op = static_cast<Op>(words[i] & 0xFFFF);
+		if (wordCount == 0 || i + wordCount > words.size()) {
+			throw std::runtime_error(std::format("'{}' has a broken instruction at word {}.", path, i));
+		}
+		const auto instruction = std::span<const uint32_t>(words).subspan(i, wordCount);
+		i += wordCount;
+
+		bool strip = isDebugInstruction(op) || isReflectionInstruction(op, instruction);
+		if (op == Op::ExtInstImport && wordCount >= 3 && isDebugInstructionSet(readLiteral(instruction.subspan(2)))) {
+			debugSets.emplace(instruction[1]);
+			strip = true;
+		}
+		if ((op == Op::ExtInst || op == Op::ExtInstWithForwardRefsKHR) && wordCount >= 5) {
+			strip = debugSets.contains(instruction[3]);
+		}
+		if (!strip) {
+			stripped.insert(stripped.end(), instruction.begin(), instruction.end());
+		}
+	}
+
+	std::vector<unsigned char> dst(stripped.size() * sizeof(uint32_t));
+	std::memcpy(dst.data(), stripped.data(), dst.size());
+	return dst;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+/// SPIR-Vモジュールからデバッグ情報・リフレクション情報を取り除く関数
+///
+/// 取り除くのはシェーダの動作に影響しない次の命令である:
+///   - OpSource, OpName, OpLineなどのデバッグ命令
+///   - NonSemantic拡張命令セット (NonSemantic.Shader.DebugInfo.100など) の命令
+///   - OpenCL.DebugInfo.100・DebugInfo拡張命令セットの命令 (取り除いたOpStringを参照するため)
+///   - UserSemanticなどのリフレクション用デコレーションとそれを宣言するOpExtension
+///
+/// スレッドセーフである。
+std::vector<unsigned char> stripSpirv(const std::string &path, std::span<const unsigned char> src);
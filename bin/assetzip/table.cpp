@@ -0,0 +1,9 @@
+#include "table.hpp"
+
+std::vector<AssetSlot> buildSlots(const std::vector<std::string> &names) {
+	std::vector<AssetSlot> slots(calcAssetSlotCount(names.size()), AssetSlot{0, EMPTY_ASSET_SLOT});
+	for (size_t i = 1; i < names.size(); ++i) {
+		insertAssetSlot(slots, hashAssetName(names[i]), static_cast<uint32_t>(i));
+	}
+	return slots;
+}
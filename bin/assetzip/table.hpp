@@ -0,0 +1,11 @@
+#pragma once
+
+#include <assetdef.hpp>
+#include <string>
+#include <vector>
+
+/// アセット名のハッシュテーブルを構築する関数
+///
+/// names[i]がi番目のエントリの名前。
+/// 0番目はconfigファイルなのでテーブルには含めない。
+std::vector<AssetSlot> buildSlots(const std::vector<std::string> &names);
@@ -0,0 +1,62 @@
+#include "trace.hpp"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+// NOTE: orgeのasset::Tracerが書き出す形式と一致させること。
+const char *const TRACE_SIGNATURE = "orge-asset-trace 1";
+
+std::vector<std::string> loadTrace(const std::string &path) {
+	std::ifstream file(path);
+	std::string line;
+	if (!file || !std::getline(file, line) || line != TRACE_SIGNATURE) {
+		throw std::runtime_error(std::format("'{}' is not an asset trace.", path));
+	}
+
+	// 各行は "<time> <name>"
+	std::vector<std::pair<uint64_t, std::string>> events;
+	while (std::getline(file, line)) {
+		std::istringstream ss(line);
+		uint64_t time = 0;
+		std::string name;
+		if (!(ss >> time) || ss.get() != ' ') {
+			throw std::runtime_error(std::format("'{}' has a broken line '{}'.", path, line));
+		}
+		std::getline(ss, name);
+		events.emplace_back(time, std::move(name));
+	}
+	std::stable_sort(events.begin(), events.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+	std::vector<std::string> names;
+	for (auto &n: events) {
+		names.push_back(std::move(n.second));
+	}
+	return names;
+}
+
+std::vector<size_t> planLayout(const std::vector<Payload> &payloads, const std::vector<std::string> &trace) {
+	std::unordered_map<std::string_view, size_t> indices;
+	for (size_t i = 1; i < payloads.size(); ++i) {
+		indices.emplace(payloads[i].name, i);
+	}
+
+	std::vector<size_t> layout{0};
+	std::vector<bool> placed(payloads.size(), false);
+	placed[0] = true;
+	for (const auto &n: trace) {
+		if (const auto it = indices.find(n); it != indices.end() && !placed[it->second]) {
+			layout.push_back(it->second);
+			placed[it->second] = true;
+		}
+	}
+	for (size_t i = 1; i < payloads.size(); ++i) {
+		if (!placed[i]) {
+			layout.push_back(i);
+		}
+	}
+	return layout;
+}
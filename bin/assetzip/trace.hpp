@@ -0,0 +1,17 @@
+#pragma once
+
+#include "writer.hpp"
+
+#include <string>
+#include <vector>
+
+/// orgeが記録したアセットの参照順を読み込む関数
+///
+/// 初回参照の早い順にアセット名を返す。
+std::vector<std::string> loadTrace(const std::string &path);
+
+/// データを書き出す順を決める関数
+///
+/// configを先頭に、traceに現れるアセットを参照順に、残りを元の順に並べる。
+/// 起動時やレベルの読込み時にまとめて参照されるアセットが連続して並ぶので、読込みが順次アクセスになる。
+std::vector<size_t> planLayout(const std::vector<Payload> &payloads, const std::vector<std::string> &trace);
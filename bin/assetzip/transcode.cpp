@@ -0,0 +1,104 @@
+#include "transcode.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <imagedef.hpp>
+#include <memory>
+#include <stdexcept>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+// NOTE: sRGBのまま平均すると暗くなるので、線形空間で平均する。
+float srgbToLinear(unsigned char c) {
+	static const auto table = []() {
+		std::array<float, 256> table;
+		for (size_t i = 0; i < table.size(); ++i) {
+			const auto v = static_cast<float>(i) / 255.0f;
+			table[i] = v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+		}
+		return table;
+	}();
+	return table[c];
+}
+
+unsigned char linearToSrgb(float v) {
+	const auto s = v <= 0.0031308f ? v * 12.92f : 1.055f * std::pow(v, 1.0f / 2.4f) - 0.055f;
+	return static_cast<unsigned char>(std::clamp(s * 255.0f + 0.5f, 0.0f, 255.0f));
+}
+
+// 2x2の箱フィルタで縮小する
+// NOTE: 奇数の辺では端のテクセルを繰り返す。
+void downsample(const unsigned char *src, uint32_t sw, uint32_t sh, unsigned char *dst, uint32_t dw, uint32_t dh) {
+	for (uint32_t y = 0; y < dh; ++y) {
+		for (uint32_t x = 0; x < dw; ++x) {
+			const std::array<uint32_t, 2> xs{std::min(x * 2, sw - 1), std::min(x * 2 + 1, sw - 1)};
+			const std::array<uint32_t, 2> ys{std::min(y * 2, sh - 1), std::min(y * 2 + 1, sh - 1)};
+			std::array<float, 4> sum{};
+			for (const auto sy: ys) {
+				for (const auto sx: xs) {
+					const auto p = src + (static_cast<size_t>(sy) * sw + sx) * RAW_IMAGE_TEXEL_SIZE;
+					sum[0] += srgbToLinear(p[0]);
+					sum[1] += srgbToLinear(p[1]);
+					sum[2] += srgbToLinear(p[2]);
+					sum[3] += static_cast<float>(p[3]);
+				}
+			}
+			const auto q = dst + (static_cast<size_t>(y) * dw + x) * RAW_IMAGE_TEXEL_SIZE;
+			q[0] = linearToSrgb(sum[0] / 4.0f);
+			q[1] = linearToSrgb(sum[1] / 4.0f);
+			q[2] = linearToSrgb(sum[2] / 4.0f);
+			q[3] = static_cast<unsigned char>(sum[3] / 4.0f + 0.5f);
+		}
+	}
+}
+
+DecodedImage decodeImage(const std::string &path, std::span<const unsigned char> src) {
+	using stbi_ptr = std::unique_ptr<stbi_uc, decltype(&stbi_image_free)>;
+
+	// NOTE: 実行時のデコードと同じく、RGBAの画像のみ受け付ける。
+	int width = 0;
+	int height = 0;
+	int channelCount = 0;
+	const auto pixels = stbi_ptr(
+		stbi_load_from_memory(src.data(), static_cast<int>(src.size()), &width, &height, &channelCount, 0),
+		stbi_image_free
+	);
+	if (!pixels) {
+		throw std::runtime_error(std::format("failed to decode '{}'.", path));
+	}
+	if (channelCount != 4) {
+		throw std::runtime_error(std::format("'{}' is not RGBA.", path));
+	}
+	const auto w = static_cast<uint32_t>(width);
+	const auto h = static_cast<uint32_t>(height);
+	const auto size = static_cast<size_t>(w) * h * RAW_IMAGE_TEXEL_SIZE;
+	return DecodedImage{w, h, std::vector<unsigned char>(pixels.get(), pixels.get() + size)};
+}
+
+std::vector<unsigned char> buildRawImage(const DecodedImage &image, bool mipmaps) {
+	// ヘッダー書込み
+	const auto w = image.width;
+	const auto h = image.height;
+	const auto mipCount = mipmaps ? calcFullMipCount(w, h) : 1;
+	const RawImageHeader header{RAW_IMAGE_MAGIC, RAW_IMAGE_VERSION, RawImageFormat::Rgba8Srgb, w, h, mipCount};
+	std::vector<unsigned char> dst(sizeof(RawImageHeader) + calcRawImageSize(w, h, mipCount));
+	std::memcpy(dst.data(), &header, sizeof(RawImageHeader));
+
+	// 各ミップレベル書込み
+	auto level = dst.data() + sizeof(RawImageHeader);
+	std::memcpy(level, image.pixels.data(), image.pixels.size());
+	for (uint32_t i = 1; i < mipCount; ++i) {
+		const auto sw = calcMipExtent(w, i - 1);
+		const auto sh = calcMipExtent(h, i - 1);
+		const auto next = level + static_cast<size_t>(sw) * sh * RAW_IMAGE_TEXEL_SIZE;
+		downsample(level, sw, sh, next, calcMipExtent(w, i), calcMipExtent(h, i));
+		level = next;
+	}
+	return dst;
+}
+
+std::vector<unsigned char> transcodeImage(const std::string &path, std::span<const unsigned char> src, bool mipmaps) {
+	return buildRawImage(decodeImage(path, src), mipmaps);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+struct DecodedImage {
+	uint32_t width;
+	uint32_t height;
+	std::vector<unsigned char> pixels; // RGBA
+};
+
+/// PNGやJPEGなどのRGBAの画像をデコードする関数
+///
+/// スレッドセーフである。
+DecodedImage decodeImage(const std::string &path, std::span<const unsigned char> src);
+
+/// デコードされた画像をimagedef.hppの形式へ変換する関数
+///
+/// mipmapsがtrueの場合、完全なミップチェーンを生成する。
+std::vector<unsigned char> buildRawImage(const DecodedImage &image, bool mipmaps);
+
+/// PNGやJPEGなどの画像をデコードし、imagedef.hppの形式へ変換する関数
+///
+/// mipmapsがtrueの場合、完全なミップチェーンを生成する。
+/// スレッドセーフである。
+std::vector<unsigned char> transcodeImage(const std::string &path, std::span<const unsigned char> src, bool mipmaps);
@@ -0,0 +1,114 @@
+#include "writer.hpp"
+
+#include "table.hpp"
+
+#include <crc32c.hpp>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+void pad(std::ofstream &out, uint64_t alignment) {
+	const auto pos = static_cast<uint64_t>(out.tellp());
+	const auto padding = (alignment - pos % alignment) % alignment;
+	const std::vector<char> zeros(padding, 0);
+	out.write(zeros.data(), zeros.size());
+}
+
+bool isSamePayload(const Payload &a, const Payload &b) {
+	return a.codec == b.codec && a.originalSize == b.originalSize && a.data == b.data;
+}
+
+WriteResult writeArchive(
+	const std::string &path,
+	const std::vector<Payload> &payloads,
+	const std::vector<size_t> &layout,
+	uint64_t alignment
+) {
+	std::ofstream out(path, std::ios::binary);
+	if (!out) {
+		throw std::runtime_error(std::format("failed to create '{}'.", path));
+	}
+
+	// ハッシュテーブル構築
+	std::vector<std::string> names;
+	for (const auto &n: payloads) {
+		names.push_back(n.name);
+	}
+	const auto slots = buildSlots(names);
+
+	// ヘッダー書込み
+	const AssetHeader header{
+		ASSET_MAGIC,
+		ASSET_VERSION,
+		static_cast<uint32_t>(payloads.size()),
+		static_cast<uint32_t>(slots.size()),
+		alignment,
+	};
+	out.write(reinterpret_cast<const char *>(&header), sizeof(AssetHeader));
+
+	// エントリーは後回し
+	const auto entriesPos = out.tellp();
+	std::vector<char> placeholder(sizeof(AssetEntry) * payloads.size(), 0);
+	out.write(placeholder.data(), placeholder.size());
+
+	// ハッシュテーブル書込み
+	out.write(reinterpret_cast<const char *>(slots.data()), sizeof(AssetSlot) * slots.size());
+
+	// アセット名書込み
+	std::vector<uint64_t> nameOffsets;
+	for (const auto &n: names) {
+		nameOffsets.push_back(static_cast<uint64_t>(out.tellp()));
+		out.write(n.data(), n.size());
+	}
+
+	// データ書込み & エントリー構築
+	// NOTE: 内容のハッシュで候補を絞り、一致するものがあればそのオフセットを使い回す。
+	std::vector<AssetEntry> entries(payloads.size());
+	std::unordered_multimap<size_t, size_t> written; // ハッシュ -> エントリ番号
+	WriteResult result{};
+	for (const auto i: layout) {
+		const auto &n = payloads[i];
+		const auto hash = std::hash<std::string_view>{}(
+			std::string_view(reinterpret_cast<const char *>(n.data.data()), n.data.size())
+		);
+		std::optional<uint64_t> offset;
+		for (auto [it, end] = written.equal_range(hash); it != end; ++it) {
+			if (isSamePayload(payloads[it->second], n)) {
+				offset = entries[it->second].offset;
+				break;
+			}
+		}
+		if (offset) {
+			result.dedupCount += 1;
+			result.dedupSize += n.data.size();
+		} else {
+			pad(out, alignment);
+			offset = static_cast<uint64_t>(out.tellp());
+			out.write(reinterpret_cast<const char *>(n.data.data()), n.data.size());
+			written.emplace(hash, i);
+		}
+		entries[i] = AssetEntry(
+			static_cast<uint32_t>(i),
+			n.codec,
+			*offset,
+			static_cast<uint64_t>(n.data.size()),
+			n.originalSize,
+			nameOffsets[i],
+			static_cast<uint32_t>(n.name.size()),
+			crc32c::compute(n.data)
+		);
+	}
+	result.archiveSize = static_cast<uint64_t>(out.tellp());
+
+	// エントリー書込み
+	out.seekp(entriesPos);
+	out.write(reinterpret_cast<const char *>(entries.data()), sizeof(AssetEntry) * entries.size());
+
+	if (!out) {
+		throw std::runtime_error(std::format("failed to write '{}'.", path));
+	}
+	return result;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <assetdef.hpp>
+#include <string>
+#include <vector>
+
+struct Payload {
+	std::string name;
+	std::vector<unsigned char> data; // 格納されるデータ (圧縮されている場合は圧縮後のもの)
+	AssetCodec codec;
+	uint64_t originalSize;
+};
+
+struct WriteResult {
+	uint64_t archiveSize;
+	uint64_t dedupCount; // 既存のデータを指すようにしたエントリの数
+	uint64_t dedupSize;  // それによって削減されたバイト数
+};
+
+/// .datファイルを書き出す関数
+///
+/// payloads[i]がi番目のエントリになる。
+/// 0番目はconfigファイルであること。
+///
+/// データはlayout (payloadsの添字の並び替え) の順に書き出す。
+/// 内容 (格納形式を含む) が同じデータは一度だけ書き出し、エントリは同じ位置を指す。
+WriteResult writeArchive(
+	const std::string &path,
+	const std::vector<Payload> &payloads,
+	const std::vector<size_t> &layout,
+	uint64_t alignment
+);
@@ -1,16 +1,102 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
+#include <string_view>
+
+// .datファイルは次の順に構成される:
+//   - AssetHeader
+//   - AssetEntry[count] (i番目のエントリのidはi、0番目はconfigファイル)
+//   - AssetSlot[slotCount] (アセット名のハッシュによる開番地法のテーブル)
+//   - アセット名 (null終端なし)
+//   - データ (各データの先頭はalignmentの倍数に揃えられる)
+//
+// 値はすべてリトルエンディアン。
+
+constexpr uint32_t ASSET_MAGIC = 0x5441444F; // "ODAT"
+constexpr uint32_t ASSET_VERSION = 3;
+
+enum class AssetCodec: uint32_t {
+	None = 0,
+	Lz4,
+};
 
 struct AssetHeader {
+	uint32_t magic;
+	uint32_t version;
 	uint32_t count;
+	uint32_t slotCount; // 2の累乗かつcountより大きい
+	uint64_t alignment; // 2の累乗
 };
 
 struct AssetEntry {
 	uint32_t id;
-	uint32_t offset;
-	uint32_t size;
+	AssetCodec codec;
+	uint64_t offset;
+	uint64_t size;
+	uint64_t originalSize;
+	uint64_t nameOffset;
+	uint32_t nameSize;
+	uint32_t checksum; // 格納されたデータ (圧縮後) のCRC32C
 
 	AssetEntry() {}
-	AssetEntry(uint32_t id, uint32_t offset, uint32_t size): id(id), offset(offset), size(size) {}
+	AssetEntry(
+		uint32_t id,
+		AssetCodec codec,
+		uint64_t offset,
+		uint64_t size,
+		uint64_t originalSize,
+		uint64_t nameOffset,
+		uint32_t nameSize,
+		uint32_t checksum
+	):
+		id(id),
+		codec(codec),
+		offset(offset),
+		size(size),
+		originalSize(originalSize),
+		nameOffset(nameOffset),
+		nameSize(nameSize),
+		checksum(checksum)
+	{}
+};
+
+constexpr uint32_t EMPTY_ASSET_SLOT = UINT32_MAX;
+
+struct AssetSlot {
+	uint32_t hash;
+	uint32_t id; // 空きスロットならEMPTY_ASSET_SLOT
 };
+
+// FNV-1a
+inline uint32_t hashAssetName(std::string_view name) noexcept {
+	uint32_t hash = 2166136261u;
+	for (const auto c: name) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/// count個の名前を格納するハッシュテーブルのスロット数を求める関数
+///
+/// NOTE: 負荷率を1/2以下に保つ。
+inline uint32_t calcAssetSlotCount(size_t count) noexcept {
+	uint32_t slotCount = 1;
+	while (slotCount < count * 2) {
+		slotCount <<= 1;
+	}
+	return slotCount;
+}
+
+/// ハッシュテーブルへ線形探索で挿入する関数
+///
+/// slotsには空きがあること。
+inline void insertAssetSlot(std::span<AssetSlot> slots, uint32_t hash, uint32_t id) noexcept {
+	const auto mask = static_cast<uint32_t>(slots.size()) - 1;
+	auto i = hash & mask;
+	while (slots[i].id != EMPTY_ASSET_SLOT) {
+		i = (i + 1) & mask;
+	}
+	slots[i] = AssetSlot{hash, id};
+}
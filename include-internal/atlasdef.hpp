@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// assetzipがスプライトをまとめたアトラスの表は次の順に構成される:
+//   - AtlasHeader
+//   - AtlasSprite[spriteCount]
+//   - 文字列 (スプライトの元のファイル名)
+//
+// アトラスの各ページは"<アトラス名>.<ページ番号>"という名前のimagedef.hppの形式の画像として格納される。
+// 値はすべてリトルエンディアン。
+
+constexpr uint32_t ATLAS_MAGIC = 0x4C54414F; // "OATL"
+constexpr uint32_t ATLAS_VERSION = 1;
+
+struct AtlasHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t pageCount;
+	uint32_t spriteCount;
+	uint64_t stringSize;
+};
+
+struct AtlasSprite {
+	uint32_t nameOffset;
+	uint32_t nameLength;
+	uint32_t page;
+	uint32_t x;
+	uint32_t y;
+	uint32_t width;
+	uint32_t height;
+	float u0; // 左上
+	float v0;
+	float u1; // 右下
+	float v1;
+};
@@ -0,0 +1,102 @@
+//! configをバイナリ表現へ変換するクラス
+//!
+//! assetzipと、変換されていないconfigを読む場合のorgeから用いる。
+
+#pragma once
+
+#include "configdef.hpp"
+#include "configscalar.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+class ConfigCompiler {
+private:
+	std::vector<ConfigNode> _nodes;
+	std::vector<uint32_t> _children;
+	std::string _strings;
+	std::unordered_map<std::string, uint32_t> _interned;
+
+	uint32_t _intern(const std::string &s) {
+		const auto [it, inserted] = _interned.emplace(s, static_cast<uint32_t>(_strings.size()));
+		if (inserted) {
+			_strings += s;
+		}
+		return it->second;
+	}
+
+	// NOTE: 真偽値と符号なし整数の両方として解釈できるスカラーはないので、値を共有する。
+	ConfigNode _scalar(const std::string &s) {
+		ConfigNode node{ConfigNodeType::Scalar, static_cast<uint32_t>(s.size()), _intern(s), 0, 0, 0.0f};
+		if (const auto b = parseConfigBool(s)) {
+			node.kinds |= CONFIG_SCALAR_BOOL;
+			node.value = *b ? 1 : 0;
+		}
+		if (const auto u = parseConfigUint(s)) {
+			node.kinds |= CONFIG_SCALAR_UINT;
+			node.value = *u;
+		}
+		if (const auto f = parseConfigFloat(s)) {
+			node.kinds |= CONFIG_SCALAR_FLOAT;
+			node.real = *f;
+		}
+		return node;
+	}
+
+	uint32_t _add(const YAML::Node &node) {
+		const auto index = static_cast<uint32_t>(_nodes.size());
+		_nodes.push_back(ConfigNode{ConfigNodeType::Null, 0, 0, 0, 0, 0.0f});
+
+		// NOTE: 子の子を先に追加するので、子のノード番号を集めてから連続して並べる。
+		std::vector<uint32_t> children;
+		switch (node.Type()) {
+		case YAML::NodeType::Scalar:
+			_nodes[index] = _scalar(node.Scalar());
+			return index;
+		case YAML::NodeType::Sequence:
+			for (const auto &n: node) {
+				children.push_back(_add(n));
+			}
+			_nodes[index] = ConfigNode{ConfigNodeType::Sequence, static_cast<uint32_t>(children.size()), 0, 0, 0, 0.0f};
+			break;
+		case YAML::NodeType::Map:
+			for (const auto &n: node) {
+				children.push_back(_add(n.first));
+				children.push_back(_add(n.second));
+			}
+			_nodes[index] = ConfigNode{ConfigNodeType::Map, static_cast<uint32_t>(children.size() / 2), 0, 0, 0, 0.0f};
+			break;
+		default:
+			return index;
+		}
+		_nodes[index].first = static_cast<uint32_t>(_children.size());
+		_children.insert(_children.end(), children.begin(), children.end());
+		return index;
+	}
+
+public:
+	/// YAMLの文書をバイナリ表現へ変換する関数
+	std::vector<unsigned char> compile(const YAML::Node &root) {
+		_add(root);
+
+		const ConfigBlobHeader header{
+			CONFIG_BLOB_MAGIC,
+			CONFIG_BLOB_VERSION,
+			static_cast<uint32_t>(_nodes.size()),
+			static_cast<uint32_t>(_children.size()),
+			static_cast<uint64_t>(_strings.size()),
+		};
+		std::vector<unsigned char> blob;
+		const auto append = [&blob](const void *src, size_t size) {
+			const auto p = static_cast<const unsigned char *>(src);
+			blob.insert(blob.end(), p, p + size);
+		};
+		append(&header, sizeof(ConfigBlobHeader));
+		append(_nodes.data(), sizeof(ConfigNode) * _nodes.size());
+		append(_children.data(), sizeof(uint32_t) * _children.size());
+		append(_strings.data(), _strings.size());
+		return blob;
+	}
+};
@@ -0,0 +1,51 @@
+//! configのバイナリ表現
+//!
+//! assetzipがconfigファイルを変換して格納し、orgeが実行時にYAMLを解析せずに読む。
+//! YAMLの文書木をそのまま平坦にしたもので、スカラーは解釈できる型の値を併せて持つ。
+//! assetzipは変換時にconfigの解析も行うので、格納されたconfigは検証済みである。
+
+#pragma once
+
+#include <cstdint>
+
+// configのバイナリ表現は次の順に構成される:
+//   - ConfigBlobHeader
+//   - ConfigNode[nodeCount] (0番目が根)
+//   - uint32_t[childCount] (配列の要素あるいはマップのキーと値を交互に並べたノード番号)
+//   - 文字列 (スカラーの値、同じ値は一つにまとめられる)
+//
+// 値はすべてリトルエンディアン。
+
+constexpr uint32_t CONFIG_BLOB_MAGIC = 0x47464343; // "CCFG"
+constexpr uint32_t CONFIG_BLOB_VERSION = 2;
+
+enum class ConfigNodeType: uint32_t {
+	Null = 0,
+	Scalar,
+	Sequence,
+	Map,
+};
+
+/// スカラーとして解釈できる型 (ConfigNode::kindsのビット)
+enum ConfigScalarKind: uint32_t {
+	CONFIG_SCALAR_BOOL = 1 << 0,
+	CONFIG_SCALAR_UINT = 1 << 1,
+	CONFIG_SCALAR_FLOAT = 1 << 2,
+};
+
+struct ConfigBlobHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t nodeCount;
+	uint32_t childCount;
+	uint64_t stringSize;
+};
+
+struct ConfigNode {
+	ConfigNodeType type;
+	uint32_t count; // スカラーならバイト数、配列なら要素数、マップならキーと値の組の数
+	uint32_t first; // スカラーなら文字列の先頭、配列・マップなら子の先頭
+	uint32_t kinds; // スカラーとして解釈できる型 (ConfigScalarKindの論理和)
+	uint32_t value; // 真偽値 (0か1) あるいは符号なし整数として解釈した値
+	float real;     // 浮動小数点数として解釈した値
+};
@@ -0,0 +1,77 @@
+//! configのスカラーの解釈
+//!
+//! yaml-cppの挙動に合わせている。
+//! ConfigCompilerが変換時に用い、orgeは実行時にスカラーを解釈しない。
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+inline std::optional<bool> parseConfigBool(std::string_view s) {
+	// NOTE: 全て小文字・全て大文字・先頭のみ大文字のいずれかを受け付ける。
+	std::string lower;
+	std::string upper;
+	for (const auto c: s) {
+		lower += c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+		upper += c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+	}
+	if (s != lower && s != upper && (s.empty() || s[0] != upper[0] || s.substr(1) != lower.substr(1))) {
+		return std::nullopt;
+	}
+	if (lower == "y" || lower == "yes" || lower == "true" || lower == "on") {
+		return true;
+	}
+	if (lower == "n" || lower == "no" || lower == "false" || lower == "off") {
+		return false;
+	}
+	return std::nullopt;
+}
+
+inline std::optional<uint32_t> parseConfigUint(std::string_view s) {
+	auto first = s.data();
+	const auto last = s.data() + s.size();
+	if (first != last && *first == '+') {
+		++first;
+	}
+	int base = 10;
+	if (last - first > 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X')) {
+		base = 16;
+		first += 2;
+	} else if (last - first > 2 && first[0] == '0' && first[1] == 'o') {
+		base = 8;
+		first += 2;
+	}
+	uint32_t value = 0;
+	const auto [p, ec] = std::from_chars(first, last, value, base);
+	if (first == last || ec != std::errc() || p != last) {
+		return std::nullopt;
+	}
+	return value;
+}
+
+inline std::optional<float> parseConfigFloat(std::string_view s) {
+	if (s == ".inf" || s == ".Inf" || s == ".INF" || s == "+.inf" || s == "+.Inf" || s == "+.INF") {
+		return std::numeric_limits<float>::infinity();
+	}
+	if (s == "-.inf" || s == "-.Inf" || s == "-.INF") {
+		return -std::numeric_limits<float>::infinity();
+	}
+	if (s == ".nan" || s == ".NaN" || s == ".NAN") {
+		return std::numeric_limits<float>::quiet_NaN();
+	}
+	std::istringstream stream{std::string(s)};
+	stream.imbue(std::locale::classic());
+	float value = 0.0f;
+	stream >> value;
+	if (s.empty() || stream.fail() || stream.peek() != std::char_traits<char>::eof()) {
+		return std::nullopt;
+	}
+	return value;
+}
@@ -0,0 +1,119 @@
+//! CRC32C (Castagnoli) の計算
+//!
+//! assetzipとorgeの両方から使われる。
+//! x86-64ではSSE4.2、AArch64ではCRC拡張が使えればそれを用い、そうでなければテーブルで計算する。
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# define CRC32C_X64
+# include <nmmintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+# define CRC32C_ARM64
+# include <arm_acle.h>
+#endif
+
+namespace crc32c {
+
+constexpr uint32_t POLYNOMIAL = 0x82F63B78; // 反転表現
+
+inline const std::array<uint32_t, 256> &table() noexcept {
+	static const auto table = []() {
+		std::array<uint32_t, 256> table;
+		for (uint32_t i = 0; i < table.size(); ++i) {
+			auto crc = i;
+			for (int j = 0; j < 8; ++j) {
+				crc = crc & 1 ? crc >> 1 ^ POLYNOMIAL : crc >> 1;
+			}
+			table[i] = crc;
+		}
+		return table;
+	}();
+	return table;
+}
+
+inline uint32_t updateSoftware(uint32_t crc, const unsigned char *p, size_t n) noexcept {
+	const auto &t = table();
+	for (size_t i = 0; i < n; ++i) {
+		crc = t[(crc ^ p[i]) & 0xFF] ^ crc >> 8;
+	}
+	return crc;
+}
+
+#if defined(CRC32C_X64)
+
+#ifndef _MSC_VER
+__attribute__((target("sse4.2")))
+#endif
+inline uint32_t updateHardware(uint32_t crc, const unsigned char *p, size_t n) noexcept {
+	uint64_t crc64 = crc;
+	for (; n >= 8; p += 8, n -= 8) {
+		uint64_t v;
+		std::memcpy(&v, p, 8);
+		crc64 = _mm_crc32_u64(crc64, v);
+	}
+	crc = static_cast<uint32_t>(crc64);
+	for (; n > 0; ++p, --n) {
+		crc = _mm_crc32_u8(crc, *p);
+	}
+	return crc;
+}
+
+inline bool hasHardware() noexcept {
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 1);
+	return (info[2] & (1 << 20)) != 0;
+#else
+	return __builtin_cpu_supports("sse4.2");
+#endif
+}
+
+#elif defined(CRC32C_ARM64)
+
+inline uint32_t updateHardware(uint32_t crc, const unsigned char *p, size_t n) noexcept {
+	for (; n >= 8; p += 8, n -= 8) {
+		uint64_t v;
+		std::memcpy(&v, p, 8);
+		crc = __crc32cd(crc, v);
+	}
+	for (; n > 0; ++p, --n) {
+		crc = __crc32cb(crc, *p);
+	}
+	return crc;
+}
+
+inline bool hasHardware() noexcept {
+	return true;
+}
+
+#else
+
+inline uint32_t updateHardware(uint32_t crc, const unsigned char *p, size_t n) noexcept {
+	return updateSoftware(crc, p, n);
+}
+
+inline bool hasHardware() noexcept {
+	return false;
+}
+
+#endif
+
+/// dataのCRC32Cを求める関数
+inline uint32_t compute(std::span<const unsigned char> data) noexcept {
+	static const auto hardware = hasHardware();
+	const auto crc = hardware
+		? updateHardware(0xFFFFFFFF, data.data(), data.size())
+		: updateSoftware(0xFFFFFFFF, data.data(), data.size());
+	return ~crc;
+}
+
+} // namespace crc32c
@@ -0,0 +1,82 @@
+//! IMA ADPCMの符号化・復号
+//!
+//! assetzipとorgeの両方から使われる。
+//! ブロックはチャンネルごとの4バイトのヘッダー (先頭サンプルのint16、ステップ表の位置、予約) に続き、
+//! チャンネルごとに8サンプル分の4バイトを交互に並べたものである。各バイトは下位4bitが先のサンプル。
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace ima {
+
+constexpr uint16_t WAVE_FORMAT_IMA_ADPCM = 0x0011;
+
+constexpr std::array<int32_t, 89> STEP_TABLE = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107,
+	118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894,
+	6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767,
+};
+
+constexpr std::array<int32_t, 16> INDEX_TABLE = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+constexpr int32_t MAX_STEP_INDEX = static_cast<int32_t>(STEP_TABLE.size()) - 1;
+
+/// 1チャンネルの符号化・復号の状態
+struct State {
+	int32_t predictor;
+	int32_t stepIndex;
+};
+
+/// チャンネルごとのヘッダーのバイト数
+constexpr uint32_t HEADER_SIZE = 4;
+
+/// バイト数blockSizeの1ブロックに含まれるフレーム数
+inline uint32_t calcBlockFrameCount(uint32_t blockSize, uint32_t channelCount) noexcept {
+	return (blockSize - HEADER_SIZE * channelCount) * 2 / channelCount + 1;
+}
+
+/// 4bitの符号nibbleを1サンプルへ復号する関数
+///
+/// 分岐せずに計算する。
+inline int32_t decode(State &state, uint32_t nibble) noexcept {
+	const auto step = STEP_TABLE[static_cast<size_t>(state.stepIndex)];
+	const auto bit = [nibble](uint32_t n) { return static_cast<int32_t>(nibble >> n & 1); };
+	const auto diff = (step >> 3) + bit(2) * step + bit(1) * (step >> 1) + bit(0) * (step >> 2);
+	const auto sign = -bit(3);
+	state.predictor = std::clamp(state.predictor + ((diff ^ sign) - sign), -32768, 32767);
+	state.stepIndex = std::clamp(state.stepIndex + INDEX_TABLE[nibble & 0xF], 0, MAX_STEP_INDEX);
+	return state.predictor;
+}
+
+/// 1サンプルを4bitの符号へ符号化する関数
+///
+/// 復号側と同じ状態を保つため、符号化した値を復号してstateを進める。
+inline uint32_t encode(State &state, int32_t sample) noexcept {
+	const auto step = STEP_TABLE[static_cast<size_t>(state.stepIndex)];
+	auto diff = sample - state.predictor;
+	uint32_t nibble = 0;
+	if (diff < 0) {
+		nibble = 8;
+		diff = -diff;
+	}
+	if (diff >= step) {
+		nibble |= 4;
+		diff -= step;
+	}
+	if (diff >= step >> 1) {
+		nibble |= 2;
+		diff -= step >> 1;
+	}
+	if (diff >= step >> 2) {
+		nibble |= 1;
+	}
+	decode(state, nibble);
+	return nibble;
+}
+
+} // namespace ima
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// assetzipが画像を事前にデコードして格納する形式は次の順に構成される:
+//   - RawImageHeader
+//   - 各ミップレベルのテクセル (レベル0から順に隙間なく並ぶ)
+//
+// 値はすべてリトルエンディアン。
+
+constexpr uint32_t RAW_IMAGE_MAGIC = 0x474D494F; // "OIMG"
+constexpr uint32_t RAW_IMAGE_VERSION = 1;
+
+enum class RawImageFormat: uint32_t {
+	Rgba8Srgb = 0,
+};
+
+struct RawImageHeader {
+	uint32_t magic;
+	uint32_t version;
+	RawImageFormat format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t mipCount;
+};
+
+constexpr uint32_t RAW_IMAGE_TEXEL_SIZE = 4;
+
+/// 完全なミップチェーンのレベル数を求める関数
+inline uint32_t calcFullMipCount(uint32_t width, uint32_t height) noexcept {
+	uint32_t count = 1;
+	for (auto n = std::max(width, height); n > 1; n >>= 1) {
+		++count;
+	}
+	return count;
+}
+
+/// ミップレベルlevelの幅または高さを求める関数
+inline uint32_t calcMipExtent(uint32_t extent, uint32_t level) noexcept {
+	return std::max(extent >> level, 1u);
+}
+
+/// 全ミップレベルのテクセルのバイト数を求める関数
+inline uint64_t calcRawImageSize(uint32_t width, uint32_t height, uint32_t mipCount) noexcept {
+	uint64_t size = 0;
+	for (uint32_t i = 0; i < mipCount; ++i) {
+		size += static_cast<uint64_t>(calcMipExtent(width, i)) * calcMipExtent(height, i) * RAW_IMAGE_TEXEL_SIZE;
+	}
+	return size;
+}
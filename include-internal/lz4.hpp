@@ -0,0 +1,164 @@
+//! LZ4ブロックフォーマットの圧縮・展開
+//!
+//! assetzipとorgeの両方から使われる。
+//! フレームフォーマットには対応しない。
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace lz4 {
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t LAST_LITERALS = 5;
+constexpr size_t MATCH_FIND_LIMIT = 12;
+constexpr size_t MAX_OFFSET = 65535;
+constexpr uint32_t HASH_BITS = 16;
+
+inline uint32_t read32(const unsigned char *p) noexcept {
+	return static_cast<uint32_t>(p[0])
+		| static_cast<uint32_t>(p[1]) << 8
+		| static_cast<uint32_t>(p[2]) << 16
+		| static_cast<uint32_t>(p[3]) << 24;
+}
+
+inline void writeLength(std::vector<unsigned char> &dst, size_t length) {
+	while (length >= 255) {
+		dst.push_back(255);
+		length -= 255;
+	}
+	dst.push_back(static_cast<unsigned char>(length));
+}
+
+inline void writeSequence(
+	std::vector<unsigned char> &dst,
+	const unsigned char *literals,
+	size_t literalLength,
+	size_t offset,
+	size_t matchLength
+) {
+	const auto ml = matchLength >= MIN_MATCH ? matchLength - MIN_MATCH : 0;
+	const auto token = static_cast<unsigned char>(std::min<size_t>(literalLength, 15) << 4 | std::min<size_t>(ml, 15));
+	dst.push_back(token);
+	if (literalLength >= 15) {
+		writeLength(dst, literalLength - 15);
+	}
+	dst.insert(dst.end(), literals, literals + literalLength);
+	// NOTE: 最終シーケンスはリテラルのみ。
+	if (matchLength == 0) {
+		return;
+	}
+	dst.push_back(static_cast<unsigned char>(offset & 0xFF));
+	dst.push_back(static_cast<unsigned char>(offset >> 8));
+	if (ml >= 15) {
+		writeLength(dst, ml - 15);
+	}
+}
+
+/// srcを圧縮する関数
+inline std::vector<unsigned char> compress(std::span<const unsigned char> src) {
+	std::vector<unsigned char> dst;
+	dst.reserve(src.size() + src.size() / 255 + 16);
+
+	const auto p = src.data();
+	const auto n = src.size();
+	size_t anchor = 0;
+
+	if (n > MATCH_FIND_LIMIT) {
+		std::vector<size_t> table(static_cast<size_t>(1) << HASH_BITS, SIZE_MAX);
+		const auto matchEnd = n - LAST_LITERALS;
+		size_t i = 0;
+		while (i < n - MATCH_FIND_LIMIT) {
+			const auto seq = read32(p + i);
+			const auto hash = (seq * 2654435761u) >> (32 - HASH_BITS);
+			const auto candidate = table[hash];
+			table[hash] = i;
+			if (candidate == SIZE_MAX || i - candidate > MAX_OFFSET || read32(p + candidate) != seq) {
+				++i;
+				continue;
+			}
+			auto length = MIN_MATCH;
+			while (i + length < matchEnd && p[candidate + length] == p[i + length]) {
+				++length;
+			}
+			writeSequence(dst, p + anchor, i - anchor, i - candidate, length);
+			i += length;
+			anchor = i;
+		}
+	}
+
+	writeSequence(dst, p + anchor, n - anchor, 0, 0);
+	return dst;
+}
+
+inline bool readLength(std::span<const unsigned char> src, size_t &ip, size_t &length) {
+	unsigned char b = 255;
+	while (b == 255) {
+		if (ip >= src.size()) {
+			return false;
+		}
+		b = src[ip++];
+		length += b;
+	}
+	return true;
+}
+
+/// srcをdstへ展開する関数
+///
+/// dstは展開後のサイズと厳密に一致していること。
+/// 入力が壊れている場合はfalseを返す。
+inline bool decompress(std::span<const unsigned char> src, std::span<unsigned char> dst) {
+	size_t ip = 0;
+	size_t op = 0;
+	while (ip < src.size()) {
+		const auto token = src[ip++];
+
+		// リテラル
+		size_t literalLength = token >> 4;
+		if (literalLength == 15 && !readLength(src, ip, literalLength)) {
+			return false;
+		}
+		if (literalLength > src.size() - ip || literalLength > dst.size() - op) {
+			return false;
+		}
+		std::copy_n(src.data() + ip, literalLength, dst.data() + op);
+		ip += literalLength;
+		op += literalLength;
+		if (ip == src.size()) {
+			break;
+		}
+
+		// マッチ
+		if (src.size() - ip < 2) {
+			return false;
+		}
+		const auto offset = static_cast<size_t>(src[ip]) | static_cast<size_t>(src[ip + 1]) << 8;
+		ip += 2;
+		if (offset == 0 || offset > op) {
+			return false;
+		}
+		size_t matchLength = token & 15;
+		if (matchLength == 15 && !readLength(src, ip, matchLength)) {
+			return false;
+		}
+		matchLength += MIN_MATCH;
+		if (matchLength > dst.size() - op) {
+			return false;
+		}
+		const auto from = dst.data() + op - offset;
+		if (offset >= matchLength) {
+			std::copy_n(from, matchLength, dst.data() + op);
+		} else {
+			for (size_t i = 0; i < matchLength; ++i) {
+				dst[op + i] = from[i];
+			}
+		}
+		op += matchLength;
+	}
+	return op == dst.size();
+}
+
+} // namespace lz4
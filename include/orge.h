@@ -63,6 +63,88 @@ API_EXPORT void orgeTerminate(void);
 /// 0以外であればウィンドウが閉じられていないことを意味する。
 API_EXPORT uint8_t orgeUpdate(void);
 
+// ================================================================================================================== //
+//     Asset                                                                                                          //
+// ================================================================================================================== //
+
+enum OrgeAssetStatistic {
+	ORGE_ASSET_STATISTIC_ARCHIVE_SIZE = 0,
+	ORGE_ASSET_STATISTIC_CACHE_SIZE,
+	ORGE_ASSET_STATISTIC_CACHE_HIT_COUNT,
+	ORGE_ASSET_STATISTIC_CACHE_MISS_COUNT,
+	ORGE_ASSET_STATISTIC_DECODED_SIZE,
+	ORGE_ASSET_STATISTIC_DECODE_TIME,
+	ORGE_ASSET_STATISTIC_RELEASED_SIZE,
+};
+
+/// アセットに関する統計値を取得する関数
+///
+/// - kind: 統計値の種類 (OrgeAssetStatistic)
+///
+/// 返戻値:
+/// - ARCHIVE_SIZE: .datファイルのサイズ (バイト数)
+/// - CACHE_SIZE: 展開キャッシュに保持されているデータのサイズ (バイト数)
+/// - CACHE_HIT_COUNT: 圧縮されたアセットの取得時にキャッシュが利用された回数
+/// - CACHE_MISS_COUNT: 圧縮されたアセットの取得時に展開が行われた回数
+/// - DECODED_SIZE: 展開されたデータの総サイズ (バイト数)
+/// - DECODE_TIME: 展開に要した総時間 (ナノ秒)
+/// - RELEASED_SIZE: GPUへのアップロード後に物理メモリから解放された.datのページの総サイズ (バイト数)
+///
+/// 不明なkindが指定された場合は0が返る。
+API_EXPORT uint64_t orgeGetAssetStatistic(uint32_t kind);
+
+// ================================================================================================================== //
+//     Async Loading                                                                                                  //
+// ================================================================================================================== //
+
+enum OrgeLoadStatus {
+	ORGE_LOAD_STATUS_PENDING = 0,
+	ORGE_LOAD_STATUS_SUCCEEDED,
+	ORGE_LOAD_STATUS_FAILED,
+};
+
+/// orgeにイメージを非同期に追加する関数
+///
+/// - file: アセットファイル名
+///
+/// デコードはワーカースレッドで行われ、GPUへのアップロードは以降のorgeUpdate()で行われる。
+/// 1フレームでアップロードされるデータ量はconfigのasync-upload-budgetで制限される。
+///
+/// 返戻値はチケットであり、失敗した場合は0が返る。
+API_EXPORT uint64_t orgeLoadImageAsync(const char *file);
+
+/// orgeにメッシュを非同期に追加する関数
+///
+/// - id: メッシュID
+///
+/// 挙動はorgeLoadImageAsync()と同様。
+API_EXPORT uint64_t orgeLoadMeshAsync(const char *id);
+
+/// orgeにWAVEを非同期に追加する関数
+///
+/// - file: アセットファイル名
+/// - startPosition: ループ開始位置
+///
+/// デコードはワーカースレッドで行われ、登録は以降のorgeUpdate()で行われる。
+///
+/// 返戻値はチケットであり、失敗した場合は0が返る。
+API_EXPORT uint64_t orgeLoadWaveAsync(const char *file, uint32_t startPosition);
+
+/// チケットの示すロードが完了しているか確認する関数
+///
+/// 返戻値はOrgeLoadStatusであり、0以外であれば完了している。
+/// 処理中あるいは不明なチケットの場合はPENDING (0) が返る。
+/// チケットは破棄されないので、完了を確認した後もorgeWaitLoaded()を呼ぶこと。
+API_EXPORT uint8_t orgeIsLoaded(uint64_t ticket);
+
+/// チケットの示すロードが完了するまで待機する関数
+///
+/// アップロードが済んでいなければこの場で行う。
+/// ロードが失敗していた場合は0が返る。
+/// この関数を呼ぶとチケットは破棄される。
+/// 全てのチケットについて一度ずつ呼ぶこと。呼ばなければチケットの情報が残り続ける。
+API_EXPORT uint8_t orgeWaitLoaded(uint64_t ticket);
+
 // ================================================================================================================== //
 //     Window                                                                                                         //
 // ================================================================================================================== //
@@ -141,6 +223,16 @@ API_EXPORT uint8_t orgeLoadImage(const char *file);
 /// イメージを破棄する関数
 API_EXPORT void orgeDestroyImage(const char *file);
 
+/// スプライトのアトラス上の位置を取得する関数
+///
+/// - atlas: アトラス名 (assetzipの--atlasで指定したもの)
+/// - file: スプライトの元のアセットファイル名
+/// - page: スプライトを含むページ番号の書込み先
+/// - uvs: UV座標 (左上のu, v, 右下のu, v) の書込み先 (長さ4)
+///
+/// アトラスの各ページはイメージ"<atlas>.<page>"としてorgeLoadImage()で追加できる。
+API_EXPORT uint8_t orgeGetSprite(const char *atlas, const char *file, uint32_t *page, float *uvs);
+
 /// orgeにストレージイメージを追加する関数
 ///
 /// - id: ストレージイメージID
@@ -533,10 +625,47 @@ API_EXPORT int32_t orgeGetMouseButtonState(uint32_t button);
 //     Audio                                                                                                          //
 // ================================================================================================================== //
 
+enum OrgeAudioStatistic {
+	ORGE_AUDIO_STATISTIC_RESIDENT_SIZE = 0,
+	ORGE_AUDIO_STATISTIC_EVICTION_COUNT,
+	ORGE_AUDIO_STATISTIC_RELOAD_COUNT,
+	ORGE_AUDIO_STATISTIC_QUEUED_SIZE,
+	ORGE_AUDIO_STATISTIC_MIX_OVERRUN_COUNT,
+	ORGE_AUDIO_STATISTIC_CALLBACK_GAP_COUNT,
+	ORGE_AUDIO_STATISTIC_MIX_TIME,
+	ORGE_AUDIO_STATISTIC_DECODE_TIME,
+	ORGE_AUDIO_STATISTIC_CONVERT_TIME,
+	ORGE_AUDIO_STATISTIC_LATENCY,
+};
+
+/// 音声に関する統計値を取得する関数
+///
+/// - kind: 統計値の種類 (OrgeAudioStatistic)
+///
+/// 返戻値:
+/// - RESIDENT_SIZE: 読み込んだWAVEのうちメモリに保持しているデータのサイズ (バイト数)
+/// - EVICTION_COUNT: configのaudio-memory-budgetを超えたためにWAVEのデータを破棄した回数
+/// - RELOAD_COUNT: 破棄したWAVEを再生するために読み込み直した回数
+/// - QUEUED_SIZE: ミキサーが合成し、まだデバイスへ送られていないデータのサイズ (バイト数)
+/// - MIX_OVERRUN_COUNT: 合成に要した時間が合成した音声の長さを超えた回数
+/// - CALLBACK_GAP_COUNT: 合成の間隔が前回合成した音声の長さの2倍を超えた回数
+///   (デバイスへの供給が途切れた可能性があるが、デバイスの読み出し量が変わっただけの場合も含む)
+/// - MIX_TIME: 合成 (再生時の変換を含む) に要した総時間 (ナノ秒)
+///   ストリーミング再生のデコードは別スレッドで先読みするので含まない
+/// - DECODE_TIME: WAVEの読込み時のデコードに要した総時間 (ナノ秒)
+/// - CONVERT_TIME: WAVEの読込み時の変換 (configのaudio-convert-on-load) に要した総時間 (ナノ秒)
+/// - LATENCY: 今合成したフレームが再生されるまでの時間 (ナノ秒)
+///
+/// 全ての音声チャンネルは1本の音声ストリームで再生されるので、QUEUED_SIZEはチャンネルごとではない。
+/// MIX_OVERRUN_COUNTとCALLBACK_GAP_COUNTはアンダーランそのものではなく、その兆候を数えたものである。
+/// 不明なkindが指定された場合や、内部で予期せぬ例外が発生した場合は0が返る。
+API_EXPORT uint64_t orgeGetAudioStatistic(uint32_t kind);
+
 /// 音声チャンネルの音量を取得する関数
 ///
 /// - index: 音声チャンネルのインデックス
 ///
+/// 音量の初期値は1.0fである。
 /// 不明なindexが指定された場合や、内部で予期せぬ例外が発生した場合は-1.0fが返る。
 API_EXPORT float orgeGetAudioChannelVolume(uint32_t index);
 
@@ -552,20 +681,58 @@ API_EXPORT uint8_t orgeSetAudioChannelVolume(uint32_t index, float volume);
 /// - startPosition: ループ開始位置
 API_EXPORT uint8_t orgeLoadWave(const char *file, uint32_t startPosition);
 
+/// orgeに複数のWAVEをまとめて追加する関数
+///
+/// - files: アセットファイル名の配列
+/// - startPositions: ループ開始位置の配列 (NULLの場合、すべて0とみなされる)
+/// - count: 配列の要素数
+///
+/// デコードはワーカースレッドで並列に行われ、すべて完了してからまとめて登録される。
+/// 1つでも失敗した場合は何も登録されない。
+API_EXPORT uint8_t orgeLoadWaves(const char *const *files, const uint32_t *startPositions, uint32_t count);
+
 /// WAVEを破棄する関数
 API_EXPORT void orgeDestroyWave(const char *file);
 
+/// WAVEの読込み時のデコードに要した時間を取得する関数
+///
+/// - file: アセットファイル名
+///
+/// 返戻値はナノ秒であり、読み込み直した場合は最後に読み込んだときのものである。
+/// ストリーミング再生するWAVEはヘッダーの解析のみの時間であり、再生中のデコードは含まれない。
+/// 読み込まれていないfileが指定された場合や、内部で予期せぬ例外が発生した場合は0が返る。
+API_EXPORT uint64_t orgeGetWaveDecodeTime(const char *file);
+
 /// WAVEを再生する関数
 ///
 /// - file: アセットファイル名
 /// - index: 音声チャンネルのインデックス
 /// - loop: ループ再生するか
 ///
-/// 初めてindex番目の音声チャンネルで音声が再生されるとき、音声ストリームが作成される。
-/// index番目の音声チャンネルとfileのWAVEの音声互換性がない場合、音声ストリームが再作成される。
+/// 全ての音声チャンネルは内部のミキサーでデバイスの形式へ変換・合成され、1本の音声ストリームで再生される。
 /// index番目の音声チャンネルが音声を再生している場合、その音声を中断してfileのWAVEを再生する。
 API_EXPORT uint8_t orgePlayWave(const char *file, uint32_t index, uint8_t loop);
 
+/// WAVEを効果音として再生する関数
+///
+/// - file: アセットファイル名
+/// - volume: 音量 ([0.0, 1.0])
+///
+/// 音声チャンネルとは別に確保された効果音のボイスのうち、空いているもので一度だけ再生する。
+/// 同じWAVEを重ねて再生でき、WAVEのデータは共有される。
+/// 空いているボイスがなければ、最も前に再生し始めた効果音を止めて再生する。
+/// 効果音のボイスの数はconfigのaudio-sound-countで指定する。
+///
+/// 返戻値はボイスのハンドルであり、失敗した場合は0が返る。
+API_EXPORT uint64_t orgePlaySound(const char *file, float volume);
+
+/// 効果音を止める関数
+///
+/// - handle: orgePlaySound()が返したハンドル
+///
+/// 既に再生し終えた場合や、そのボイスが別の効果音を再生している場合は何もしない。
+API_EXPORT void orgeStopSound(uint64_t handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,158 @@
+#include "archive.hpp"
+
+#include <format>
+#include <fstream>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# define NOMINMAX
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace asset {
+
+#ifdef _WIN32
+
+bool Archive::_map(const std::string &path) {
+	const auto file = CreateFileA(
+		path.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL,
+		nullptr
+	);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+		CloseHandle(file);
+		return false;
+	}
+
+	// NOTE: ビューが生きている限りマッピングとファイルは開かれたままになるので、ハンドルはすぐ閉じて良い。
+	const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping) {
+		return false;
+	}
+	const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view) {
+		return false;
+	}
+
+	_data = static_cast<const unsigned char *>(view);
+	_size = static_cast<size_t>(size.QuadPart);
+	return true;
+}
+
+void Archive::_unmap() noexcept {
+	UnmapViewOfFile(_data);
+}
+
+size_t getPageSize() noexcept {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return static_cast<size_t>(info.dwPageSize);
+}
+
+// NOTE: ロックされていないページにVirtualUnlockを呼ぶと、そのページはワーキングセットから外される。
+void releasePages(const unsigned char *p, size_t size) noexcept {
+	VirtualUnlock(const_cast<unsigned char *>(p), size);
+}
+
+#else
+
+bool Archive::_map(const std::string &path) {
+	const auto fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return false;
+	}
+
+	// NOTE: マッピングが生きている限りファイルは参照され続けるので、fdはすぐ閉じて良い。
+	const auto size = static_cast<size_t>(st.st_size);
+	const auto p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		return false;
+	}
+
+	_data = static_cast<const unsigned char *>(p);
+	_size = size;
+	return true;
+}
+
+void Archive::_unmap() noexcept {
+	munmap(const_cast<unsigned char *>(_data), _size);
+}
+
+size_t getPageSize() noexcept {
+	return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// NOTE: 読込み専用のファイルマッピングなので、破棄したページは次の参照時にファイルから読み直される。
+void releasePages(const unsigned char *p, size_t size) noexcept {
+	madvise(const_cast<unsigned char *>(p), size, MADV_DONTNEED);
+}
+
+#endif
+
+void Archive::_read(const std::string &path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::format("{} not found.", path);
+	}
+
+	file.seekg(0, std::ios::end);
+	const auto size = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	_buffer.resize(static_cast<size_t>(size));
+	file.read(reinterpret_cast<char *>(_buffer.data()), size);
+
+	_data = _buffer.data();
+	_size = _buffer.size();
+}
+
+Archive::Archive(const std::string &path): _data(nullptr), _size(0), _mapped(false) {
+	_mapped = _map(path);
+	if (!_mapped) {
+		_read(path);
+	}
+}
+
+size_t Archive::release(size_t offset, size_t size) const noexcept {
+	if (!_mapped) {
+		return 0;
+	}
+	// NOTE: 前後のエントリと共有するページは解放しない。
+	static const auto page = getPageSize();
+	const auto begin = (offset + page - 1) / page * page;
+	const auto end = (offset + size) / page * page;
+	if (begin >= end) {
+		return 0;
+	}
+	releasePages(_data + begin, end - begin);
+	return end - begin;
+}
+
+Archive::~Archive() {
+	if (_mapped) {
+		_unmap();
+	}
+}
+
+} // namespace asset
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace asset {
+
+/// .datファイルの内容を保持するクラス
+///
+/// 可能であればファイルをメモリマップし、ページは必要になったときにOSによって読み込まれる。
+/// メモリマップに失敗した場合はファイル全体をメモリに読み込む。
+class Archive {
+private:
+	std::vector<unsigned char> _buffer;
+	const unsigned char *_data;
+	size_t _size;
+	bool _mapped;
+
+	bool _map(const std::string &path);
+
+	void _unmap() noexcept;
+
+	void _read(const std::string &path);
+
+public:
+	Archive() = delete;
+	Archive(const Archive &) = delete;
+	Archive &operator =(const Archive &) = delete;
+
+	Archive(const std::string &path);
+	~Archive();
+
+	bool isMapped() const noexcept {
+		return _mapped;
+	}
+
+	std::span<const unsigned char> data() const noexcept {
+		return std::span<const unsigned char>(_data, _size);
+	}
+
+	/// [offset, offset + size)の範囲に完全に含まれるページを物理メモリから解放する関数
+	///
+	/// 解放されたページは再び参照されたときにOSによって読み込み直される。
+	/// メモリマップしていない場合は何もしない。
+	/// 解放したバイト数を返す。
+	size_t release(size_t offset, size_t size) const noexcept;
+};
+
+} // namespace asset
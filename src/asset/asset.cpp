@@ -1,72 +1,143 @@
 #include "asset.hpp"
 
-#include <assetdef.hpp>
-#include <fstream>
-#include <unordered_map>
-#include <vector>
+#include "cache.hpp"
+#include "codec.hpp"
+#include "index.hpp"
+#include "trace.hpp"
+#include "verify.hpp"
+
+#include <filesystem>
+#include <format>
+#include <thread>
 
 namespace asset {
 
-std::vector<unsigned char> g_dat;
-std::unordered_map<uint32_t, AssetEntry> g_assetMap;
+Index g_index;
+Cache g_cache;
+Verifier g_verifier;
+Tracer g_tracer;
+uint64_t g_releasedSize;
+std::thread g_verifierThread;
+std::atomic<bool> g_verifierStop;
 
-void loadDatFile() {
-	std::ifstream file(".dat", std::ios::binary);
-	if (!file) {
-		throw ".dat not found.";
+void stopVerifier() noexcept {
+	g_verifierStop = true;
+	if (g_verifierThread.joinable()) {
+		g_verifierThread.join();
 	}
+}
 
-	file.seekg(0, std::ios::end);
-	const auto size = file.tellg();
-	file.seekg(0, std::ios::beg);
+void initialize() {
+	// NOTE: 再初期化や初期化の失敗後の再試行に備え、前回マウントしたものを破棄してから始める。
+	stopVerifier();
+	g_index.clear();
 
-	g_dat.clear();
-	g_dat.resize(size);
-	file.read(reinterpret_cast<char *>(g_dat.data()), size);
+	// NOTE: .datの後に.dat.1, .dat.2, ...を連番が途切れるまで順にマウントする。
+	g_index.mount(".dat");
+	for (uint32_t i = 1; std::filesystem::exists(std::format(".dat.{}", i)); ++i) {
+		g_index.mount(std::format(".dat.{}", i));
+	}
+	g_index.build();
+	g_verifier.reset(g_index.count());
 }
 
-void analyzeDat() {
-	size_t offset = 0;
+void terminate() noexcept {
+	stopVerifier();
+	g_tracer.save();
+	g_cache.clear();
+	g_index.clear();
+	g_releasedSize = 0;
+	resetDecodeStatistics();
+}
 
-	// ヘッダー取得
-	if (g_dat.size() < sizeof(AssetHeader)) {
-		throw ".dat is invalid: no header.";
-	}
-	const AssetHeader *header = reinterpret_cast<const AssetHeader *>(g_dat.data());
-	offset += sizeof(AssetHeader);
+void startTrace(const std::string &path) {
+	g_tracer.start(path, g_index.count());
+}
 
-	// エントリの先頭取得
-	if (g_dat.size() < offset + sizeof(AssetEntry) * header->count) {
-		throw ".dat is invalid: too small.";
+void update() noexcept {
+	g_cache.nextFrame();
+}
+
+void setCacheCapacity(size_t capacity) noexcept {
+	g_cache.setCapacity(capacity);
+}
+
+std::span<const unsigned char> getVerifiedData(uint32_t id, const Record &record) {
+	g_tracer.record(id, record.volume->name(*record.entry));
+	const auto data = record.volume->data(*record.entry);
+	if (!g_verifier.verify(id, *record.entry, data)) {
+		throw std::format("the asset '{}' is corrupted.", record.volume->name(*record.entry));
 	}
-	const AssetEntry *entries = reinterpret_cast<const AssetEntry *>(g_dat.data() + offset);
+	return data;
+}
 
-	// エントリ取得
-	for (uint32_t i = 0; i < header->count; ++i) {
-		const auto &entry = entries[i];
-		if (entry.offset + entry.size > g_dat.size()) {
-			throw ".dat is invalid: too small.";
+void verifyAllInBackground() {
+	if (g_verifierThread.joinable()) {
+		return;
+	}
+	// NOTE: 前回のterminate()で立てたままなので、再初期化後のために戻す。
+	g_verifierStop = false;
+	g_verifierThread = std::thread([]() {
+		for (uint32_t i = 0; i < g_index.count() && !g_verifierStop; ++i) {
+			const auto &record = g_index.record(i);
+			g_verifier.verify(i, *record.entry, record.volume->data(*record.entry));
 		}
-		g_assetMap[entry.id] = entry;
+	});
+}
+
+std::span<const unsigned char> getEntryData(uint32_t id, bool pin) {
+	const auto &record = g_index.record(id);
+	const auto data = getVerifiedData(id, record);
+	if (record.entry->codec == AssetCodec::None) {
+		return data;
 	}
+	return g_cache.get(id, *record.entry, data, pin);
 }
 
-void initialize() {
-	loadDatFile();
-	analyzeDat();
+std::span<const unsigned char> loadAsset(uint32_t id, std::vector<unsigned char> &buffer) {
+	const auto &record = g_index.record(id);
+	const auto data = getVerifiedData(id, record);
+	if (record.entry->codec == AssetCodec::None) {
+		return data;
+	}
+	buffer.resize(record.entry->originalSize);
+	decode(*record.entry, data, buffer);
+	return buffer;
+}
+
+uint32_t getAssetId(std::string_view name) {
+	return g_index.find(name);
+}
+
+void release(uint32_t id) {
+	const auto &record = g_index.record(id);
+	g_releasedSize += record.volume->release(*record.entry);
+	g_cache.release(id);
 }
 
 std::span<const unsigned char> getConfigData() {
-	const auto &entry = g_assetMap[0];
-	const unsigned char *data = g_dat.data() + entry.offset;
-	return std::span<const unsigned char>(data, entry.size);
+	return getEntryData(0, false);
 }
 
 std::span<const unsigned char> getAsset(uint32_t id) {
-	// NOTE: 0はconfigファイルに予約されているので+1する。
-	const auto &entry = g_assetMap[id + 1];
-	const unsigned char *data = g_dat.data() + entry.offset;
-	return std::span<const unsigned char>(data, entry.size);
+	return getEntryData(id, false);
+}
+
+std::span<const unsigned char> getPinnedAsset(uint32_t id) {
+	return getEntryData(id, true);
+}
+
+Statistics statistics() noexcept {
+	const auto &cs = g_cache.statistics();
+	return Statistics{
+		g_index.archiveSize(),
+		g_cache.size(),
+		cs.hitCount,
+		cs.missCount,
+		decodedSize(),
+		decodeTime(),
+		g_releasedSize,
+	};
 }
 
 } // namespace asset
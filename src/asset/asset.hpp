@@ -2,13 +2,91 @@
 
 #include <cstdint>
 #include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace asset {
 
+struct Statistics {
+	uint64_t archiveSize;
+	uint64_t cacheSize;
+	uint64_t cacheHitCount;
+	uint64_t cacheMissCount;
+	uint64_t decodedSize;
+	uint64_t decodeTime; // ns
+	uint64_t releasedSize;
+};
+
+/// .datをマウントする関数
+///
+/// .datに続けて.dat.1, .dat.2, ...が存在すれば、パッチとして順にマウントする。
+/// 後にマウントされたものほど優先され、同名のアセットを上書きする。
 void initialize();
 
+/// 全アセットの検証を止め、参照の記録を書き出す関数
+void terminate() noexcept;
+
+/// 各アセットの初回参照の記録を始める関数
+///
+/// 記録はterminate()でpathへ書き出される。
+/// assetzipの--traceに渡すと、.dat内のデータが参照順に並べ直される。
+void startTrace(const std::string &path);
+
+/// 全アセットのチェックサムの検証をバックグラウンドで始める関数
+///
+/// NOTE: 検証は通常、各アセットの初回参照時に行われる。
+///       これを呼ぶと参照前に検証が済み、初回参照時のコストがなくなる。
+///       壊れたアセットが見つかった場合は、参照時に例外が発生する。
+void verifyAllInBackground();
+
+/// フレームの終わりを通知する関数
+///
+/// 展開キャッシュが容量を超えている場合、このときに古いものから破棄される。
+void update() noexcept;
+
+/// 展開キャッシュの容量を設定する関数 (バイト数)
+void setCacheCapacity(size_t capacity) noexcept;
+
+/// アセット名からアセットIDを取得する関数
+///
+/// パッチがなければ.datに格納されたハッシュテーブルを引くだけなので、実行時にマップは構築されない。
+/// パッチがあればマウント時に統合されたハッシュテーブルを引く。
+/// 存在しない場合は例外が発生する。
+/// 初期化後は読むだけなのでスレッドセーフである。
+uint32_t getAssetId(std::string_view name);
+
 std::span<const unsigned char> getConfigData();
 
+/// アセットを取得する関数
+///
+/// 初回参照時にチェックサムが検証され、一致しなければ例外が発生する。
+/// 圧縮されたアセットの場合、返されるデータは少なくとも次のupdate()まで有効である。
 std::span<const unsigned char> getAsset(uint32_t id);
 
+/// アセットを取得し、そのデータを以降も有効なままにする関数
+///
+/// 取得したデータを長期間参照し続ける場合に用いる。
+std::span<const unsigned char> getPinnedAsset(uint32_t id);
+
+/// キャッシュを介さずにアセットを取得する関数
+///
+/// 圧縮されたアセットの場合はbufferへ展開され、返されるデータはbufferが生きている間有効である。
+/// そうでない場合は.datのデータがそのまま返される。
+/// 一度しか参照しないアセットの取得に用いる。
+///
+/// getAssetId()と同様にスレッドセーフである。
+std::span<const unsigned char> loadAsset(uint32_t id, std::vector<unsigned char> &buffer);
+
+/// アセットのデータが当面不要になったことを通知する関数
+///
+/// GPUへアップロードし終えたアセットなどに用いる。
+/// そのアセットだけが載っているページは物理メモリから解放され、展開キャッシュからも破棄される。
+/// 再び取得された場合は透過的に読み込み直される。
+///
+/// NOTE: 取得したデータをまだ参照している場合は呼んではならない。
+void release(uint32_t id);
+
+Statistics statistics() noexcept;
+
 } // namespace asset
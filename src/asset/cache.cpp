@@ -0,0 +1,62 @@
+#include "cache.hpp"
+
+#include "codec.hpp"
+
+namespace asset {
+
+void Cache::_evict() noexcept {
+	auto it = _lru.end();
+	while (_size > _capacity && it != _lru.begin()) {
+		--it;
+		const auto item = _items.find(*it);
+		if (item->second.pinned || item->second.frame == _frame) {
+			continue;
+		}
+		_size -= item->second.data.size();
+		_items.erase(item);
+		it = _lru.erase(it);
+	}
+}
+
+void Cache::clear() noexcept {
+	_items.clear();
+	_lru.clear();
+	_size = 0;
+	_statistics = {};
+}
+
+void Cache::release(uint32_t id) noexcept {
+	const auto item = _items.find(id);
+	if (item == _items.end() || item->second.pinned || item->second.frame == _frame) {
+		return;
+	}
+	_size -= item->second.data.size();
+	_lru.erase(item->second.lru);
+	_items.erase(item);
+}
+
+std::span<const unsigned char> Cache::get(uint32_t id, const AssetEntry &entry, std::span<const unsigned char> src, bool pin) {
+	// キャッシュヒット
+	if (const auto found = _items.find(id); found != _items.end()) {
+		auto &item = found->second;
+		item.frame = _frame;
+		item.pinned = item.pinned || pin;
+		_lru.splice(_lru.begin(), _lru, item.lru);
+		_statistics.hitCount += 1;
+		return item.data;
+	}
+
+	// 展開
+	std::vector<unsigned char> data(entry.originalSize);
+	decode(entry, src, data);
+	_statistics.missCount += 1;
+
+	// 登録
+	_size += data.size();
+	_lru.push_front(id);
+	const auto [it, _] = _items.emplace(id, Item{std::move(data), _frame, pin, _lru.begin()});
+	_evict();
+	return it->second.data;
+}
+
+} // namespace asset
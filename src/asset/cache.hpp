@@ -0,0 +1,80 @@
+#pragma once
+
+#include <assetdef.hpp>
+#include <list>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace asset {
+
+struct CacheStatistics {
+	uint64_t hitCount;
+	uint64_t missCount;
+};
+
+/// 圧縮されたアセットの展開結果を保持するLRUキャッシュ
+///
+/// 容量を超えた場合、固定されておらず現在のフレームで参照されていないものから古い順に破棄される。
+/// 従って、get()で得たデータは少なくともそのフレームの間は有効である。
+class Cache {
+private:
+	struct Item {
+		std::vector<unsigned char> data;
+		uint64_t frame;
+		bool pinned;
+		std::list<uint32_t>::iterator lru;
+	};
+
+	size_t _capacity;
+	size_t _size;
+	uint64_t _frame;
+	std::list<uint32_t> _lru; // 先頭が最新
+	std::unordered_map<uint32_t, Item> _items;
+	CacheStatistics _statistics;
+
+	void _evict() noexcept;
+
+public:
+	Cache(const Cache &) = delete;
+	Cache &operator =(const Cache &) = delete;
+
+	Cache(): _capacity(0), _size(0), _frame(0), _statistics{} {}
+
+	size_t size() const noexcept {
+		return _size;
+	}
+
+	const CacheStatistics &statistics() const noexcept {
+		return _statistics;
+	}
+
+	void setCapacity(size_t capacity) noexcept {
+		_capacity = capacity;
+		_evict();
+	}
+
+	void nextFrame() noexcept {
+		_frame += 1;
+		_evict();
+	}
+
+	/// 固定されているものも含め、全ての展開結果と統計値を破棄する関数
+	///
+	/// アセットIDの対応が変わる再初期化の際に呼ぶ。
+	void clear() noexcept;
+
+	/// idの展開結果を破棄する関数
+	///
+	/// 固定されているもの・現在のフレームで参照されたものは破棄しない。
+	void release(uint32_t id) noexcept;
+
+	/// エントリの展開結果を取得する関数
+	///
+	/// キャッシュにはidで登録される。
+	/// キャッシュに存在しない場合はsrcを展開して登録する。
+	/// pinがtrueの場合、以降そのエントリは破棄されなくなる。
+	std::span<const unsigned char> get(uint32_t id, const AssetEntry &entry, std::span<const unsigned char> src, bool pin);
+};
+
+} // namespace asset
@@ -0,0 +1,42 @@
+#include "codec.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <lz4.hpp>
+
+namespace asset {
+
+std::atomic<uint64_t> g_decodedSize;
+std::atomic<uint64_t> g_decodeTime;
+
+void decode(const AssetEntry &entry, std::span<const unsigned char> src, std::span<unsigned char> dst) {
+	const auto start = std::chrono::steady_clock::now();
+	switch (entry.codec) {
+	case AssetCodec::Lz4:
+		if (!lz4::decompress(src, dst)) {
+			throw std::format("failed to decompress the asset {}.", entry.id);
+		}
+		break;
+	default:
+		throw std::format("the codec of the asset {} is unsupported.", entry.id);
+	}
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	g_decodedSize += dst.size();
+	g_decodeTime += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void resetDecodeStatistics() noexcept {
+	g_decodedSize = 0;
+	g_decodeTime = 0;
+}
+
+uint64_t decodedSize() noexcept {
+	return g_decodedSize;
+}
+
+uint64_t decodeTime() noexcept {
+	return g_decodeTime;
+}
+
+} // namespace asset
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <assetdef.hpp>
+#include <span>
+
+namespace asset {
+
+/// 圧縮されたエントリのデータsrcをdstへ展開する関数
+///
+/// dstはエントリの展開後サイズと一致していること。
+/// スレッドセーフである。
+void decode(const AssetEntry &entry, std::span<const unsigned char> src, std::span<unsigned char> dst);
+
+/// decodedSize()とdecodeTime()を0に戻す関数
+void resetDecodeStatistics() noexcept;
+
+uint64_t decodedSize() noexcept;
+
+uint64_t decodeTime() noexcept;
+
+} // namespace asset
@@ -0,0 +1,91 @@
+#include "index.hpp"
+
+#include <format>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace asset {
+
+void Index::mount(const std::string &path) {
+	_volumes.push_back(std::make_unique<Volume>(path));
+}
+
+void Index::clear() noexcept {
+	_slots = {};
+	_mergedSlots.clear();
+	_records.clear();
+	_volumes.clear();
+}
+
+void Index::build() {
+	// ベース
+	const auto &base = *_volumes.front();
+	for (uint32_t i = 0; i < base.count(); ++i) {
+		_records.push_back(Record{&base, &base.entry(i)});
+	}
+	if (_volumes.size() == 1) {
+		_slots = base.slots();
+		return;
+	}
+
+	// パッチ
+	// NOTE: パッチの0番目のエントリはassetzipに渡したconfigなので、アセットとしては扱わない。
+	//       ベースのconfigと同名のアセットがあればconfigを上書きする。
+	std::unordered_map<std::string_view, uint32_t> ids;
+	for (uint32_t i = 0; i < base.count(); ++i) {
+		ids.emplace(base.name(base.entry(i)), i);
+	}
+	for (size_t v = 1; v < _volumes.size(); ++v) {
+		const auto &patch = *_volumes[v];
+		for (uint32_t i = 1; i < patch.count(); ++i) {
+			const Record record{&patch, &patch.entry(i)};
+			const auto [it, inserted] = ids.emplace(patch.name(*record.entry), static_cast<uint32_t>(_records.size()));
+			if (inserted) {
+				_records.push_back(record);
+			} else {
+				_records[it->second] = record;
+			}
+		}
+	}
+
+	// 統合されたハッシュテーブル構築
+	_mergedSlots.assign(calcAssetSlotCount(_records.size()), AssetSlot{0, EMPTY_ASSET_SLOT});
+	for (uint32_t i = 1; i < _records.size(); ++i) {
+		const auto &record = _records[i];
+		insertAssetSlot(_mergedSlots, hashAssetName(record.volume->name(*record.entry)), i);
+	}
+	_slots = _mergedSlots;
+}
+
+uint64_t Index::archiveSize() const noexcept {
+	uint64_t size = 0;
+	for (const auto &n: _volumes) {
+		size += n->size();
+	}
+	return size;
+}
+
+const Record &Index::record(uint32_t id) const {
+	if (id >= _records.size()) {
+		throw std::out_of_range(std::format("the asset id {} is invalid.", id));
+	}
+	return _records[id];
+}
+
+uint32_t Index::find(std::string_view name) const {
+	const auto hash = hashAssetName(name);
+	const auto mask = static_cast<uint32_t>(_slots.size()) - 1;
+	auto i = hash & mask;
+	for (size_t n = 0; n < _slots.size() && _slots[i].id != EMPTY_ASSET_SLOT; ++n) {
+		if (_slots[i].hash == hash) {
+			const auto &record = this->record(_slots[i].id);
+			if (record.volume->name(*record.entry) == name) {
+				return _slots[i].id;
+			}
+		}
+		i = (i + 1) & mask;
+	}
+	throw std::out_of_range(std::format("the key '{}' is invalid for assets.", name));
+}
+
+} // namespace asset
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "volume.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace asset {
+
+// NOTE: 各アセットIDについて、最後にマウントされた.datのエントリを指す。
+struct Record {
+	const Volume *volume;
+	const AssetEntry *entry;
+};
+
+/// マウントされた全.datのエントリを統合して引くためのクラス
+class Index {
+private:
+	std::vector<std::unique_ptr<Volume>> _volumes;
+	std::vector<Record> _records;
+	std::vector<AssetSlot> _mergedSlots;
+	std::span<const AssetSlot> _slots;
+
+public:
+	void mount(const std::string &path);
+
+	/// マウントした全.datを閉じ、アセットIDの対応を破棄する関数
+	void clear() noexcept;
+
+	/// マウントされた.datからアセットIDの対応を構築する関数
+	///
+	/// パッチがなければベースのハッシュテーブルをそのまま使う。
+	void build();
+
+	uint32_t count() const noexcept {
+		return static_cast<uint32_t>(_records.size());
+	}
+
+	uint64_t archiveSize() const noexcept;
+
+	/// 存在しない場合は例外が発生する。
+	const Record &record(uint32_t id) const;
+
+	/// 存在しない場合は例外が発生する。
+	uint32_t find(std::string_view name) const;
+};
+
+} // namespace asset
@@ -0,0 +1,47 @@
+#include "trace.hpp"
+
+#include <format>
+#include <fstream>
+
+namespace asset {
+
+void Tracer::start(const std::string &path, uint32_t count) {
+	const std::lock_guard<std::mutex> lock(_mutex);
+	_path = path;
+	_start = std::chrono::steady_clock::now();
+	_seen.assign(count, false);
+	_events.clear();
+	_enabled = true;
+}
+
+void Tracer::record(uint32_t id, std::string_view name) {
+	// NOTE: 記録していない場合にロックを取らないよう、先に確認する。
+	if (!_enabled) {
+		return;
+	}
+	const std::lock_guard<std::mutex> lock(_mutex);
+	if (!_enabled || id >= _seen.size() || _seen[id]) {
+		return;
+	}
+	_seen[id] = true;
+	const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start);
+	_events.push_back(Event{static_cast<uint64_t>(time.count()), std::string(name)});
+}
+
+void Tracer::save() noexcept {
+	try {
+		const std::lock_guard<std::mutex> lock(_mutex);
+		if (!_enabled) {
+			return;
+		}
+		_enabled = false;
+		std::ofstream file(_path);
+		file << "orge-asset-trace 1\n";
+		for (const auto &n: _events) {
+			file << std::format("{} {}\n", n.time, n.name);
+		}
+	} catch (...) {
+	}
+}
+
+} // namespace asset
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace asset {
+
+/// 各アセットの初回参照を記録するクラス
+///
+/// 記録はassetzipの--traceに渡し、.dat内のデータを参照順に並べ直すために用いる。
+/// ファイルの一行目は"orge-asset-trace 1"、以降の各行は"<開始からのナノ秒> <アセット名>"である。
+class Tracer {
+private:
+	struct Event {
+		uint64_t time;
+		std::string name;
+	};
+
+	std::atomic<bool> _enabled;
+	std::mutex _mutex;
+	std::string _path;
+	std::chrono::steady_clock::time_point _start;
+	std::vector<bool> _seen;
+	std::vector<Event> _events;
+
+public:
+	/// 記録を始める関数
+	///
+	/// countはアセットIDの数。
+	void start(const std::string &path, uint32_t count);
+
+	/// 記録中であれば、idの初回参照を記録する関数
+	///
+	/// スレッドセーフである。
+	void record(uint32_t id, std::string_view name);
+
+	/// 記録をファイルへ書き出す関数
+	///
+	/// NOTE: 終了処理中に呼ばれるので、書き出せなくても例外は発生させない。
+	void save() noexcept;
+};
+
+} // namespace asset
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <assetdef.hpp>
+#include <atomic>
+#include <crc32c.hpp>
+#include <memory>
+
+namespace asset {
+
+/// 各アセットの格納データのチェックサムを高々一度だけ検証するクラス
+class Verifier {
+private:
+	enum class State: uint8_t {
+		Unverified,
+		Valid,
+		Corrupted,
+	};
+
+	std::unique_ptr<std::atomic<State>[]> _states;
+
+public:
+	Verifier(const Verifier &) = delete;
+	Verifier &operator =(const Verifier &) = delete;
+
+	Verifier() = default;
+
+	void reset(size_t count) {
+		_states = std::make_unique<std::atomic<State>[]>(count);
+	}
+
+	/// アセットidのデータdataを検証する関数
+	///
+	/// 検証済みであれば結果を返すだけなので、二度目以降のコストは無視できる。
+	/// スレッドセーフである。
+	bool verify(uint32_t id, const AssetEntry &entry, std::span<const unsigned char> data) noexcept {
+		auto &state = _states[id];
+		const auto current = state.load(std::memory_order_acquire);
+		if (current != State::Unverified) {
+			return current == State::Valid;
+		}
+		// NOTE: 複数のスレッドが同時に検証しても結果は同じなので、排他しない。
+		const auto valid = crc32c::compute(data) == entry.checksum;
+		state.store(valid ? State::Valid : State::Corrupted, std::memory_order_release);
+		return valid;
+	}
+};
+
+} // namespace asset
@@ -0,0 +1,57 @@
+#include "volume.hpp"
+
+#include <format>
+
+namespace asset {
+
+Volume::Volume(const std::string &path): _archive(path) {
+	const auto dat = _archive.data();
+	size_t offset = 0;
+
+	// ヘッダー取得
+	if (dat.size() < sizeof(AssetHeader)) {
+		throw std::format("{} is invalid: no header.", path);
+	}
+	_header = reinterpret_cast<const AssetHeader *>(dat.data());
+	offset += sizeof(AssetHeader);
+	if (_header->magic != ASSET_MAGIC) {
+		throw std::format("{} is invalid: not an asset archive.", path);
+	}
+	if (_header->version != ASSET_VERSION) {
+		throw std::format("{} is invalid: version {} is not supported (expected {}).", path, _header->version, ASSET_VERSION);
+	}
+	if (_header->alignment == 0 || (_header->alignment & (_header->alignment - 1)) != 0) {
+		throw std::format("{} is invalid: broken alignment.", path);
+	}
+	if (_header->count == 0) {
+		throw std::format("{} is invalid: no config.", path);
+	}
+	if (_header->slotCount <= _header->count || (_header->slotCount & (_header->slotCount - 1)) != 0) {
+		throw std::format("{} is invalid: broken hash table.", path);
+	}
+
+	// エントリ・ハッシュテーブルの先頭取得
+	const auto tableSize = sizeof(AssetEntry) * _header->count + sizeof(AssetSlot) * _header->slotCount;
+	if (dat.size() < offset + tableSize) {
+		throw std::format("{} is invalid: too small.", path);
+	}
+	_entries = reinterpret_cast<const AssetEntry *>(dat.data() + offset);
+	offset += sizeof(AssetEntry) * _header->count;
+	_slots = reinterpret_cast<const AssetSlot *>(dat.data() + offset);
+
+	// 各エントリの範囲検証
+	const auto size = static_cast<uint64_t>(dat.size());
+	for (uint32_t i = 0; i < _header->count; ++i) {
+		const auto &entry = _entries[i];
+		if (
+			entry.offset > size
+				|| entry.size > size - entry.offset
+				|| entry.nameOffset > size
+				|| entry.nameSize > size - entry.nameOffset
+		) {
+			throw std::format("{} is invalid: the entry {} is out of range.", path, i);
+		}
+	}
+}
+
+} // namespace asset
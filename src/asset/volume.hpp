@@ -0,0 +1,56 @@
+#pragma once
+
+#include "archive.hpp"
+
+#include <assetdef.hpp>
+#include <string_view>
+
+namespace asset {
+
+/// 一つの.datファイルを検証し、その内容を参照するためのクラス
+class Volume {
+private:
+	Archive _archive;
+	const AssetHeader *_header;
+	const AssetEntry *_entries;
+	const AssetSlot *_slots;
+
+public:
+	Volume() = delete;
+	Volume(const Volume &) = delete;
+	Volume &operator =(const Volume &) = delete;
+
+	/// NOTE: 全エントリの範囲をここで検証するので、以降の参照では検証しない。
+	Volume(const std::string &path);
+
+	size_t size() const noexcept {
+		return _archive.data().size();
+	}
+
+	uint32_t count() const noexcept {
+		return _header->count;
+	}
+
+	std::span<const AssetSlot> slots() const noexcept {
+		return std::span<const AssetSlot>(_slots, _header->slotCount);
+	}
+
+	const AssetEntry &entry(uint32_t index) const noexcept {
+		return _entries[index];
+	}
+
+	std::string_view name(const AssetEntry &entry) const noexcept {
+		const auto name = _archive.data().subspan(entry.nameOffset, entry.nameSize);
+		return std::string_view(reinterpret_cast<const char *>(name.data()), name.size());
+	}
+
+	std::span<const unsigned char> data(const AssetEntry &entry) const noexcept {
+		return _archive.data().subspan(entry.offset, entry.size);
+	}
+
+	size_t release(const AssetEntry &entry) const noexcept {
+		return _archive.release(entry.offset, entry.size);
+	}
+};
+
+} // namespace asset
@@ -0,0 +1,68 @@
+#include "adpcm.hpp"
+
+#include <algorithm>
+
+namespace audio {
+
+void AdpcmDecoder::reset(const Wave &wave) noexcept {
+	_data = wave.data;
+	_channelCount = static_cast<uint32_t>(wave.spec.channels);
+	_blockSize = wave.adpcm.blockSize;
+	_blockFrameCount = ima::calcBlockFrameCount(_blockSize, _channelCount);
+	_frameCount = wave.adpcm.frameCount;
+	_position = 0;
+}
+
+uint32_t AdpcmDecoder::read(float *dst, uint32_t frameCount) noexcept {
+	constexpr float scale = 1.0f / 32768.0f;
+	const auto cc = _channelCount;
+	// NOTE: 8サンプルずつのまとまりも、チャンネルごとに4バイトずつ並ぶのでヘッダーと同じ大きさである。
+	const auto groupSize = ima::HEADER_SIZE * cc;
+	uint32_t done = 0;
+	while (done < frameCount && _position < _frameCount) {
+		const auto offset = _position % _blockFrameCount;
+		const auto block = _data.data() + static_cast<size_t>(_position / _blockFrameCount) * _blockSize;
+
+		// ブロックの先頭フレームはヘッダーにそのまま格納されている
+		if (offset == 0) {
+			for (uint32_t c = 0; c < cc; ++c) {
+				const auto header = block + ima::HEADER_SIZE * c;
+				_states[c].predictor = static_cast<int16_t>(header[0] | header[1] << 8);
+				_states[c].stepIndex = std::min(static_cast<int32_t>(header[2]), ima::MAX_STEP_INDEX);
+				dst[done * cc + c] = static_cast<float>(_states[c].predictor) * scale;
+			}
+			++done;
+			++_position;
+			continue;
+		}
+
+		// ブロックの残り
+		const auto count = std::min({_blockFrameCount - offset, _frameCount - _position, frameCount - done});
+		for (uint32_t i = 0; i < count; ++i) {
+			const auto sample = offset + i - 1;
+			const auto group = block + groupSize * (sample / 8 + 1);
+			const auto byte = sample % 8 / 2;
+			const auto shift = (sample & 1) * 4;
+			for (uint32_t c = 0; c < cc; ++c) {
+				const auto nibble = static_cast<uint32_t>(group[ima::HEADER_SIZE * c + byte] >> shift);
+				dst[(done + i) * cc + c] = static_cast<float>(ima::decode(_states[c], nibble & 0xF)) * scale;
+			}
+		}
+		done += count;
+		_position += count;
+	}
+	return done;
+}
+
+void AdpcmDecoder::seek(uint32_t frame) noexcept {
+	frame = frame < _frameCount ? frame : 0;
+	_position = frame - frame % _blockFrameCount;
+	std::array<float, 64 * MAX_CHANNEL_COUNT> skipped;
+	while (_position < frame) {
+		if (read(skipped.data(), std::min(64u, frame - _position)) == 0) {
+			break;
+		}
+	}
+}
+
+} // namespace audio
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "wave.hpp"
+
+#include <array>
+#include <imaadpcm.hpp>
+
+namespace audio {
+
+/// IMA ADPCMのWaveを先頭から順に復号するクラス
+///
+/// 結果は32bit浮動小数点のインターリーブされたPCMである。
+/// メモリを確保しないので、オーディオスレッドで使っても良い。
+class AdpcmDecoder {
+private:
+	std::span<const Uint8> _data;
+	uint32_t _channelCount;
+	uint32_t _blockSize;
+	uint32_t _blockFrameCount;
+	uint32_t _frameCount;
+	uint32_t _position;
+	std::array<ima::State, MAX_CHANNEL_COUNT> _states;
+
+public:
+	AdpcmDecoder(): _channelCount(0), _blockSize(0), _blockFrameCount(0), _frameCount(0), _position(0), _states{} {}
+
+	/// waveを先頭から復号するよう設定する関数
+	///
+	/// waveはIMA ADPCMであり、次にreset()するまで有効であること。
+	void reset(const Wave &wave) noexcept;
+
+	/// 最大frameCountフレームをdstへ復号する関数
+	///
+	/// 復号したフレーム数を返す。終端に達していれば0を返す。
+	uint32_t read(float *dst, uint32_t frameCount) noexcept;
+
+	/// 次に復号する位置をframeへ移す関数
+	///
+	/// ブロックの途中へは、そのブロックの先頭から復号して進める。
+	void seek(uint32_t frame) noexcept;
+};
+
+} // namespace audio
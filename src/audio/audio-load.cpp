@@ -0,0 +1,57 @@
+#include "audio.hpp"
+
+#include "../loader/loader.hpp"
+#include "load.hpp"
+
+#include <exception>
+
+namespace audio {
+
+void Audio::loadWaveFromFile(const std::string &file, uint32_t startPosition) {
+	_addWave(file, startPosition, loadWave(file, startPosition, _mixer.spec()));
+}
+
+uint64_t Audio::loadWaveFromFileAsync(const std::string &file, uint32_t startPosition) {
+	return loader::enqueue([file, startPosition, spec = _mixer.spec()]() {
+		const auto wave = loadWave(file, startPosition, spec);
+		return std::make_pair(
+			loader::Finalizer([file, startPosition, wave]() { audio()._addWave(file, startPosition, wave); }),
+			static_cast<size_t>(0)
+		);
+	});
+}
+
+void Audio::loadWavesFromFiles(std::span<const std::string> files, std::span<const uint32_t> startPositions) {
+	// NOTE: デコードはローダーのワーカースレッドで並列に行い、全て成功した場合のみまとめて登録する。
+	//       失敗したものがあっても、全てのチケットを待って破棄してから送出する。
+	if (files.size() != startPositions.size()) {
+		throw "the number of files and start positions must be the same.";
+	}
+	const auto spec = _mixer.spec();
+	const auto waves = std::make_shared<std::vector<std::shared_ptr<Wave>>>(files.size());
+	std::vector<uint64_t> tickets;
+	for (size_t i = 0; i < files.size(); ++i) {
+		tickets.push_back(loader::enqueue([waves, i, file = files[i], startPosition = startPositions[i], spec]() {
+			(*waves)[i] = loadWave(file, startPosition, spec);
+			return std::make_pair(loader::Finalizer(), static_cast<size_t>(0));
+		}));
+	}
+	std::exception_ptr exception;
+	for (const auto n: tickets) {
+		try {
+			loader::wait(n);
+		} catch (...) {
+			exception = exception ? exception : std::current_exception();
+		}
+	}
+	if (exception) {
+		std::rethrow_exception(exception);
+	}
+
+	for (size_t i = 0; i < files.size(); ++i) {
+		_waves.add(files[i], startPositions[i], std::move((*waves)[i]));
+	}
+	_evict();
+}
+
+} // namespace audio
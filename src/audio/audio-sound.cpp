@@ -0,0 +1,51 @@
+#include "audio.hpp"
+
+#include <mutex>
+
+namespace audio {
+
+uint64_t Audio::playSound(std::string_view file, float volume) {
+	if (volume < 0.0f || volume > 1.0f) {
+		throw std::format("the sound volume must be between 0 and 1 but passed {}.", volume);
+	}
+	if (_soundSerials.empty()) {
+		throw "no voices for sounds.";
+	}
+	const auto &wave = _waves.get(file, _reloader);
+
+	// 空いているボイスを探す
+	// NOTE: 空いていなければ最も前に再生し始めたものを使う。
+	size_t slot = 0;
+	for (size_t i = 0; i < _soundSerials.size(); ++i) {
+		if (!_mixer.voice(_channelCount + static_cast<uint32_t>(i)).playing()) {
+			slot = i;
+			break;
+		}
+		if (_soundSerials[i] < _soundSerials[slot]) {
+			slot = i;
+		}
+	}
+	auto &voice = _mixer.voice(_channelCount + static_cast<uint32_t>(slot));
+
+	auto stream = _openStream(std::string(file), wave, false);
+	{
+		std::lock_guard lock(_mixer);
+		voice.start(wave, std::move(stream), false, _mixer.spec().freq);
+		voice.setGain(volume);
+	}
+	_soundSerial = _soundSerial == UINT32_MAX ? 1 : _soundSerial + 1;
+	_soundSerials[slot] = _soundSerial;
+	_evict();
+	return static_cast<uint64_t>(_soundSerial) << 32 | static_cast<uint64_t>(slot);
+}
+
+void Audio::stopSound(uint64_t handle) noexcept {
+	const auto slot = static_cast<size_t>(handle & UINT32_MAX);
+	if (slot >= _soundSerials.size() || _soundSerials[slot] != static_cast<uint32_t>(handle >> 32)) {
+		return;
+	}
+	std::lock_guard lock(_mixer);
+	_mixer.voice(_channelCount + static_cast<uint32_t>(slot)).stop();
+}
+
+} // namespace audio
@@ -2,83 +2,141 @@
 
 #include "../config/config.hpp"
 #include "../error/error.hpp"
+#include "load.hpp"
+
+#include <mutex>
 
 namespace audio {
 
-bool isSameSpec(const SDL_AudioSpec &a, const SDL_AudioSpec &b) {
-	return a.format == b.format && a.channels == b.channels && a.freq == b.freq;
+SDL_AudioDeviceID openDevice() {
+	const auto device = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, nullptr);
+	if (device == 0) {
+		throw "failed to open an audio device.";
+	}
+	return device;
 }
 
 Audio::Audio():
-	_device(SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, nullptr)),
-	_channels(config::config().audioChannelCount)
-{
-	if (_device == 0) {
-		throw "failed to open an audio device.";
+	_device(openDevice()),
+	_channelCount(config::config().audioChannelCount),
+	_mixer(
+		_device,
+		_channelCount + config::config().audioSoundCount,
+		config::config().audioStatisticsLogInterval
+	),
+	_soundSerials(config::config().audioSoundCount, 0),
+	_soundSerial(0),
+	_waves(static_cast<size_t>(config::config().audioMemoryBudget) << 20),
+	_reloader([this](const std::string &file, uint32_t startPosition) {
+		return loadWave(file, startPosition, _mixer.spec());
+	})
+{}
+
+void Audio::_checkChannel(uint32_t index) const {
+	if (index >= _channelCount) {
+		throw std::out_of_range(std::format("the key '{}' is invalid for channels.", index));
 	}
 }
 
-void Audio::update() {
-	for (const auto &n: _channels) {
-		if (!n || !n->loop || !n->binding) {
-			continue;
-		}
-		const auto length = n->binding->length - n->binding->startByte;
-		if (SDL_GetAudioStreamQueued(n->stream.get()) >= static_cast<int>(length)) {
-			continue;
-		}
-		const auto buffer = n->binding->buffer.get() + n->binding->startByte;
-		if (!SDL_PutAudioStreamData(n->stream.get(), static_cast<const void *>(buffer), static_cast<int>(length))) {
-			throw "failed to put a wave data to the stream.";
+void Audio::_addWave(const std::string &file, uint32_t startPosition, std::shared_ptr<Wave> wave) {
+	_waves.add(file, startPosition, std::move(wave));
+	_evict();
+}
+
+void Audio::_evict() noexcept {
+	if (!_waves.overBudget()) {
+		return;
+	}
+	// NOTE: 再生を終えたボイスが持つWAVEを手放し、破棄できるようにする。
+	{
+		std::lock_guard lock(_mixer);
+		for (auto &n: _mixer.voices()) {
+			if (!n.playing() && n.wave()) {
+				n.release();
+			}
 		}
 	}
+	_waves.evict();
 }
 
-float Audio::getVolume(uint32_t index) const {
-	auto &channel = error::at(_channels, index, "channels");
-	if (!channel || !channel->stream) {
-		throw std::format("the {} th audio channel is uninitialized.", index);
+std::shared_ptr<OggStream> Audio::_openStream(
+	const std::string &file,
+	const std::shared_ptr<Wave> &wave,
+	bool loop
+) {
+	if (!wave->streamed) {
+		return nullptr;
 	}
-	return SDL_GetAudioStreamGain(channel->stream.get());
+	auto stream = std::make_shared<OggStream>(file, wave, loop);
+	_streamer.add(stream);
+	return stream;
+}
+
+float Audio::getVolume(uint32_t index) const {
+	_checkChannel(index);
+	return _mixer.voice(index).gain();
 }
 
 void Audio::setVolume(uint32_t index, float volume) {
 	if (volume < 0.0f || volume > 1.0f) {
 		throw std::format("the audio channel volume must be between 0 and 1 but passed {}.", volume);
 	}
-	auto &channel = error::at(_channels, index, "channels");
-	if (!channel || !channel->stream) {
-		throw std::format("the {} th audio channel is uninitialized.", index);
+	_checkChannel(index);
+	auto &voice = _mixer.voice(index);
+	std::lock_guard lock(_mixer);
+	voice.setGain(volume);
+}
+
+void Audio::destroyWave(const std::string &file) noexcept {
+	const auto wave = _waves.remove(file);
+	if (!wave) {
+		return;
 	}
-	if (!SDL_SetAudioStreamGain(channel->stream.get(), volume)) {
-		throw "failed to set the volume of an audio stream.";
+
+	// NOTE: 再生を終えたチャンネルが持つWAVEはここで手放す。
+	//       再生中のものは次にそのチャンネルで再生するときに手放される。
+	std::lock_guard lock(_mixer);
+	for (auto &n: _mixer.voices()) {
+		if (!n.playing() && n.wave() == wave) {
+			n.release();
+		}
 	}
 }
 
 void Audio::play(const std::string &file, uint32_t index, bool loop) {
-	auto &wave = error::at(_waves, file, "waves");
-	auto &channel = error::at(_channels, index, "channels");
-
-	if (!channel || !channel->binding || !isSameSpec(channel->binding->spec, wave->spec)) {
-		auto stream = SDL_CreateAudioStream(&wave->spec, nullptr);
-		if (!stream) {
-			throw "failed to create an audio stream.";
-		}
-		_channels[index] = std::make_unique<AudioChannel>(stream);
-		if (!SDL_BindAudioStream(_device, _channels[index]->stream.get())) {
-			_channels[index] = nullptr;
-			throw "failed to bind an audio stream to the device.";
-		}
-	} else if (!SDL_ClearAudioStream(channel->stream.get())) {
-		throw "failed to clear an audio stream.";
+	_checkChannel(index);
+	auto &voice = _mixer.voice(index);
+	// NOTE: 予算を超えて破棄されていれば、ここで読み込み直す。
+	const auto &wave = _waves.get(file, _reloader);
+
+	// NOTE: ストリーミング再生の場合はストリーミングスレッドが先読みし、オーディオスレッドはそれを合成する。
+	auto stream = _openStream(file, wave, loop);
+	{
+		std::lock_guard lock(_mixer);
+		voice.start(wave, std::move(stream), loop, _mixer.spec().freq);
 	}
+	_evict();
+}
 
-	channel->binding = wave;
-	channel->loop = loop;
+uint64_t Audio::getDecodeTime(std::string_view file) const {
+	return _waves.decodeTime(file);
+}
 
-	if (!SDL_PutAudioStreamData(channel->stream.get(), wave->buffer.get(), wave->length)) {
-		throw "failed to put a wave data to the stream.";
-	}
+Statistics Audio::statistics() const noexcept {
+	const auto &bs = _waves.statistics();
+	const auto ms = _mixer.statistics();
+	return Statistics{
+		_waves.size(),
+		bs.evictionCount,
+		bs.reloadCount,
+		ms.queuedSize,
+		ms.mixOverrunCount,
+		ms.callbackGapCount,
+		ms.mixTime,
+		decodeTime(),
+		convertTime(),
+		ms.latency,
+	};
 }
 
 std::optional<Audio> g_audio;
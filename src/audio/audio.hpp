@@ -1,31 +1,45 @@
 #pragma once
 
-#include "wave.hpp"
+#include "bank.hpp"
+#include "mixer.hpp"
+#include "stream.hpp"
 
-#include <unordered_map>
-#include <vector>
+#include <span>
 
 namespace audio {
 
-struct AudioChannel {
-	using Stream = std::unique_ptr<SDL_AudioStream, decltype(&SDL_DestroyAudioStream)>;
-
-	const Stream stream;
-	std::shared_ptr<Wave> binding;
-	bool loop;
-
-	AudioChannel(SDL_AudioStream *stream):
-		stream(Stream(stream, SDL_DestroyAudioStream)),
-		binding(nullptr),
-		loop(false)
-	{}
+struct Statistics {
+	uint64_t residentSize;
+	uint64_t evictionCount;
+	uint64_t reloadCount;
+	uint64_t queuedSize;
+	uint64_t mixOverrunCount;
+	uint64_t callbackGapCount;
+	uint64_t mixTime;     // ns
+	uint64_t decodeTime;  // ns
+	uint64_t convertTime; // ns
+	uint64_t latency;     // ns
 };
 
 class Audio {
 private:
 	const SDL_AudioDeviceID _device;
-	std::vector<std::unique_ptr<AudioChannel>> _channels;
-	std::unordered_map<std::string, std::shared_ptr<Wave>> _waves;
+	const uint32_t _channelCount;
+	Mixer _mixer;                        // 先頭_channelCount個のボイスがチャンネル、残りが効果音である
+	std::vector<uint32_t> _soundSerials; // 効果音のボイスごとに、最後に再生し始めたときの通し番号
+	uint32_t _soundSerial;
+	WaveBank _waves;
+	const WaveBank::Loader _reloader; // 破棄されたWAVEを読み込み直す関数
+	Streamer _streamer;
+
+	/// ストリーミング再生するWAVEならOggStreamを作って先読みを始める関数
+	std::shared_ptr<OggStream> _openStream(const std::string &file, const std::shared_ptr<Wave> &wave, bool loop);
+
+	void _checkChannel(uint32_t index) const;
+
+	void _addWave(const std::string &file, uint32_t startPosition, std::shared_ptr<Wave> wave);
+
+	void _evict() noexcept;
 
 public:
 	Audio(const Audio &) = delete;
@@ -38,23 +52,47 @@ public:
 		SDL_CloseAudioDevice(_device);
 	}
 
-	void update();
-
 	float getVolume(uint32_t index) const;
 
 	void setVolume(uint32_t index, float volume);
 
-	void loadWaveFromFile(const std::string &file, uint32_t startPosition) {
-		_waves.emplace(file, Wave::fromFile(file, startPosition));
-	}
+	void loadWaveFromFile(const std::string &file, uint32_t startPosition);
 
-	void destroyWave(const std::string &file) noexcept {
-		if (_waves.contains(file)) {
-			_waves.erase(file);
-		}
-	}
+	/// WAVEのデコードをワーカースレッドで行う関数
+	///
+	/// ローダーのチケットを返す。
+	uint64_t loadWaveFromFileAsync(const std::string &file, uint32_t startPosition);
+
+	/// 複数のWAVEをワーカースレッドで並列にデコードし、全て完了してからまとめて追加する関数
+	///
+	/// 1つでも失敗した場合は何も追加せずに例外を送出する。
+	void loadWavesFromFiles(std::span<const std::string> files, std::span<const uint32_t> startPositions);
+
+	/// WAVEを破棄する関数
+	///
+	/// 再生中のチャンネルは再生し終えるまでWAVEを保持し続ける。
+	void destroyWave(const std::string &file) noexcept;
 
 	void play(const std::string &file, uint32_t index, bool loop);
+
+	/// 効果音を再生する関数
+	///
+	/// 空いている効果音のボイスで再生する。空いていなければ最も前に再生し始めたものを止めて使う。
+	/// ボイスのハンドル (0以外) を返す。
+	/// ストリーミング再生するWAVEでなく、読み込み直す必要もなければ、メモリを確保しない。
+	uint64_t playSound(std::string_view file, float volume);
+
+	/// 効果音を止める関数
+	///
+	/// handleのボイスが既に別の効果音を再生していれば何もしない。
+	void stopSound(uint64_t handle) noexcept;
+
+	/// WAVEの読込み時のデコードに要した時間 (ナノ秒)
+	///
+	/// 読み込み直した場合は最後に読み込んだときのもの。
+	uint64_t getDecodeTime(std::string_view file) const;
+
+	Statistics statistics() const noexcept;
 };
 
 void initialize();
@@ -0,0 +1,77 @@
+#include "bank.hpp"
+
+#include <format>
+#include <stdexcept>
+
+namespace audio {
+
+void WaveBank::add(const std::string &file, uint32_t startPosition, std::shared_ptr<Wave> wave) {
+	if (_items.contains(file)) {
+		return;
+	}
+	_size += wave->storage.size();
+	_lru.push_front(file);
+	const auto decodeTime = wave->decodeTime;
+	_items.emplace(file, Item{std::move(wave), startPosition, decodeTime, _lru.begin()});
+}
+
+std::shared_ptr<Wave> WaveBank::remove(const std::string &file) noexcept {
+	const auto found = _items.find(file);
+	if (found == _items.end()) {
+		return nullptr;
+	}
+	auto wave = std::move(found->second.wave);
+	if (wave) {
+		_size -= wave->storage.size();
+		_lru.erase(found->second.lru);
+	}
+	_items.erase(found);
+	return wave;
+}
+
+const std::shared_ptr<Wave> &WaveBank::get(std::string_view file, const Loader &loader) {
+	const auto found = _items.find(file);
+	if (found == _items.end()) {
+		throw std::out_of_range(std::format("the key '{}' is invalid for waves.", file));
+	}
+	auto &item = found->second;
+	if (item.wave) {
+		_lru.splice(_lru.begin(), _lru, item.lru);
+		return item.wave;
+	}
+
+	// 読み込み直し
+	item.wave = loader(found->first, item.startPosition);
+	_size += item.wave->storage.size();
+	item.decodeTime = item.wave->decodeTime;
+	_lru.push_front(found->first);
+	item.lru = _lru.begin();
+	_statistics.reloadCount += 1;
+	return item.wave;
+}
+
+uint64_t WaveBank::decodeTime(std::string_view file) const {
+	const auto found = _items.find(file);
+	if (found == _items.end()) {
+		throw std::out_of_range(std::format("the key '{}' is invalid for waves.", file));
+	}
+	return found->second.decodeTime;
+}
+
+void WaveBank::evict() noexcept {
+	auto it = _lru.end();
+	while (overBudget() && it != _lru.begin()) {
+		--it;
+		auto &wave = _items.find(*it)->second.wave;
+		// NOTE: ボイスが保持しているものと、アーカイブ内のデータを直接指していて破棄しても減らないものは残す。
+		if (wave.use_count() > 1 || wave->storage.empty()) {
+			continue;
+		}
+		_size -= wave->storage.size();
+		wave.reset();
+		it = _lru.erase(it);
+		_statistics.evictionCount += 1;
+	}
+}
+
+} // namespace audio
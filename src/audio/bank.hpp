@@ -0,0 +1,94 @@
+#pragma once
+
+#include "wave.hpp"
+
+#include <functional>
+#include <list>
+#include <string_view>
+#include <unordered_map>
+
+namespace audio {
+
+struct BankStatistics {
+	uint64_t evictionCount;
+	uint64_t reloadCount;
+};
+
+/// 読み込んだWAVEを保持するクラス
+///
+/// 予算を超えた場合、どのボイスにも保持されていないものから古い順にデータを破棄する。
+/// 破棄されたWAVEは次に取得されたときに読み込み直される。
+class WaveBank {
+public:
+	using Loader = std::function<std::shared_ptr<Wave>(const std::string &file, uint32_t startPosition)>;
+
+private:
+	// NOTE: 再生時にstd::stringを作らずに引けるようにするため。
+	struct Hash {
+		using is_transparent = void;
+
+		size_t operator ()(std::string_view s) const noexcept {
+			return std::hash<std::string_view>()(s);
+		}
+	};
+
+	struct Item {
+		std::shared_ptr<Wave> wave; // データを破棄していればnullptr
+		uint32_t startPosition;
+		uint64_t decodeTime; // 最後に読み込んだときのデコードに要した時間 (ナノ秒)
+		std::list<std::string>::iterator lru;
+	};
+
+	size_t _budget; // 0なら無制限
+	size_t _size;
+	std::list<std::string> _lru; // データを保持しているもののみ。先頭が最新
+	std::unordered_map<std::string, Item, Hash, std::equal_to<>> _items;
+	BankStatistics _statistics;
+
+public:
+	WaveBank(const WaveBank &) = delete;
+	WaveBank &operator =(const WaveBank &) = delete;
+
+	WaveBank(size_t budget): _budget(budget), _size(0), _statistics{} {}
+
+	/// 保持しているデータのサイズ (バイト数)
+	size_t size() const noexcept {
+		return _size;
+	}
+
+	bool overBudget() const noexcept {
+		return _budget > 0 && _size > _budget;
+	}
+
+	const BankStatistics &statistics() const noexcept {
+		return _statistics;
+	}
+
+	/// WAVEを追加する関数
+	///
+	/// 既にfileが存在する場合は何もしない。
+	/// startPositionは読み込み直すときにloaderへ渡される。
+	void add(const std::string &file, uint32_t startPosition, std::shared_ptr<Wave> wave);
+
+	/// WAVEを取り除く関数
+	///
+	/// 取り除いたWAVEを返す。存在しないかデータを破棄していればnullptrを返す。
+	std::shared_ptr<Wave> remove(const std::string &file) noexcept;
+
+	/// WAVEを取得する関数
+	///
+	/// データを破棄していればloaderで読み込み直す。
+	/// 存在しない場合はstd::out_of_rangeを投げる。
+	/// 読み込み直さない限りメモリを確保しない。
+	const std::shared_ptr<Wave> &get(std::string_view file, const Loader &loader);
+
+	/// 最後に読み込んだときのデコードに要した時間 (ナノ秒)
+	///
+	/// 存在しない場合はstd::out_of_rangeを投げる。
+	uint64_t decodeTime(std::string_view file) const;
+
+	/// 予算に収まるまで、どこからも参照されていないWAVEのデータを古い順に破棄する関数
+	void evict() noexcept;
+};
+
+} // namespace audio
@@ -0,0 +1,122 @@
+#include "convert.hpp"
+
+#include "simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace audio {
+
+template<typename T>
+T loadSample(const Uint8 *src, bool swap) noexcept {
+	Uint8 bytes[sizeof(T)];
+	for (size_t i = 0; i < sizeof(T); ++i) {
+		bytes[i] = src[swap ? sizeof(T) - 1 - i : i];
+	}
+	T value;
+	std::memcpy(&value, bytes, sizeof(T));
+	return value;
+}
+
+// NOTE: ネイティブエンディアンのS16のみ。
+void convertS16ToFloat(const Uint8 *src, float *dst, size_t count) noexcept {
+	constexpr float scale = 1.0f / 32768.0f;
+	size_t i = 0;
+#if defined(AUDIO_SSE2)
+	const auto s = _mm_set1_ps(scale);
+	for (; i + 8 <= count; i += 8) {
+		const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+		// NOTE: 上位16bitへ置いてから算術シフトすることで符号拡張する。
+		const auto lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		const auto hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), s));
+		_mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), s));
+	}
+#elif defined(AUDIO_NEON)
+	for (; i + 8 <= count; i += 8) {
+		const auto v = vreinterpretq_s16_u8(vld1q_u8(src + i * 2));
+		vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), scale));
+		vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), scale));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] = static_cast<float>(loadSample<int16_t>(src + i * 2, false)) * scale;
+	}
+}
+
+void convertToFloat(const Uint8 *src, SDL_AudioFormat format, float *dst, size_t count) noexcept {
+	const auto swap = (SDL_AUDIO_ISBIGENDIAN(format) != 0) != (std::endian::native == std::endian::big);
+	switch (format) {
+	case SDL_AUDIO_U8:
+		for (size_t i = 0; i < count; ++i) {
+			dst[i] = static_cast<float>(static_cast<int>(src[i]) - 128) / 128.0f;
+		}
+		return;
+	case SDL_AUDIO_S8:
+		for (size_t i = 0; i < count; ++i) {
+			dst[i] = static_cast<float>(static_cast<int8_t>(src[i])) / 128.0f;
+		}
+		return;
+	case SDL_AUDIO_S16LE:
+	case SDL_AUDIO_S16BE:
+		if (!swap) {
+			convertS16ToFloat(src, dst, count);
+			return;
+		}
+		for (size_t i = 0; i < count; ++i) {
+			dst[i] = static_cast<float>(loadSample<int16_t>(src + i * 2, true)) / 32768.0f;
+		}
+		return;
+	case SDL_AUDIO_S32LE:
+	case SDL_AUDIO_S32BE:
+		for (size_t i = 0; i < count; ++i) {
+			dst[i] = static_cast<float>(loadSample<int32_t>(src + i * 4, swap)) / 2147483648.0f;
+		}
+		return;
+	case SDL_AUDIO_F32LE:
+	case SDL_AUDIO_F32BE:
+		if (!swap) {
+			std::memcpy(dst, src, count * sizeof(float));
+			return;
+		}
+		for (size_t i = 0; i < count; ++i) {
+			dst[i] = loadSample<float>(src + i * 4, true);
+		}
+		return;
+	default:
+		std::fill_n(dst, count, 0.0f);
+		return;
+	}
+}
+
+// NOTE: S16からの変換と同じく32768倍し、1.0は飽和させて32767とする。
+void convertFloatToS16(const float *src, Sint16 *dst, size_t count) noexcept {
+	constexpr float scale = 32768.0f;
+	size_t i = 0;
+#if defined(AUDIO_SSE2)
+	const auto s = _mm_set1_ps(scale);
+	const auto lower = _mm_set1_ps(-1.0f);
+	const auto upper = _mm_set1_ps(1.0f);
+	for (; i + 8 <= count; i += 8) {
+		// NOTE: 範囲外の値は整数へ変換できないので、先に丸め込んでおく。
+		const auto lo = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lower), upper);
+		const auto hi = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), lower), upper);
+		const auto v = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(lo, s)), _mm_cvtps_epi32(_mm_mul_ps(hi, s)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), v);
+	}
+#elif defined(AUDIO_NEON)
+	for (; i + 8 <= count; i += 8) {
+		const auto lo = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i), scale));
+		const auto hi = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i + 4), scale));
+		vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+	}
+#endif
+	for (; i < count; ++i) {
+		const auto value = std::nearbyint(std::clamp(src[i], -1.0f, 1.0f) * scale);
+		dst[i] = static_cast<Sint16>(std::min(value, 32767.0f));
+	}
+}
+
+} // namespace audio
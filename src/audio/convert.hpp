@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <SDL3/SDL_audio.h>
+
+namespace audio {
+
+/// 形式formatのPCMのcount個のサンプルをfloatへ変換してdstへ書き込む関数
+///
+/// 未対応の形式の場合は無音を書き込む。
+void convertToFloat(const Uint8 *src, SDL_AudioFormat format, float *dst, size_t count) noexcept;
+
+/// floatのcount個のサンプルをネイティブエンディアンのS16へ変換してdstへ書き込む関数
+///
+/// [-1.0, 1.0]の範囲外は飽和させる。
+void convertFloatToS16(const float *src, Sint16 *dst, size_t count) noexcept;
+
+} // namespace audio
@@ -0,0 +1,92 @@
+#include "downmix.hpp"
+
+#include <cmath>
+#include <span>
+
+namespace audio {
+
+enum class Speaker: uint8_t {FL, FR, FC, LFE, BL, BR, SL, SR, BC};
+
+// NOTE: SDLの3ch・5chはLFEを含む2.1ch・4.1chであり、Vorbisの3ch・5chとは構成自体が異なる。
+constexpr Speaker SDL_LAYOUTS[][8] = {
+	{Speaker::FL, Speaker::FR, Speaker::LFE},
+	{Speaker::FL, Speaker::FR, Speaker::BL, Speaker::BR},
+	{Speaker::FL, Speaker::FR, Speaker::LFE, Speaker::BL, Speaker::BR},
+	{Speaker::FL, Speaker::FR, Speaker::FC, Speaker::LFE, Speaker::BL, Speaker::BR},
+	{Speaker::FL, Speaker::FR, Speaker::FC, Speaker::LFE, Speaker::BC, Speaker::SL, Speaker::SR},
+	{Speaker::FL, Speaker::FR, Speaker::FC, Speaker::LFE, Speaker::BL, Speaker::BR, Speaker::SL, Speaker::SR},
+};
+
+constexpr Speaker VORBIS_LAYOUTS[][8] = {
+	{Speaker::FL, Speaker::FC, Speaker::FR},
+	{Speaker::FL, Speaker::FR, Speaker::BL, Speaker::BR},
+	{Speaker::FL, Speaker::FC, Speaker::FR, Speaker::BL, Speaker::BR},
+	{Speaker::FL, Speaker::FC, Speaker::FR, Speaker::BL, Speaker::BR, Speaker::LFE},
+	{Speaker::FL, Speaker::FC, Speaker::FR, Speaker::SL, Speaker::SR, Speaker::BC, Speaker::LFE},
+	{Speaker::FL, Speaker::FC, Speaker::FR, Speaker::SL, Speaker::SR, Speaker::BL, Speaker::BR, Speaker::LFE},
+};
+
+constexpr int MIN_LAYOUT_CHANNEL_COUNT = 3;
+constexpr int LAYOUT_COUNT = static_cast<int>(std::size(SDL_LAYOUTS));
+
+DownmixMatrix createDownmixMatrix(std::span<const Speaker> speakers) noexcept {
+	const auto half = static_cast<float>(std::sqrt(0.5));
+	DownmixMatrix matrix{};
+	float leftSum = 0.0f;
+	float rightSum = 0.0f;
+	for (size_t i = 0; i < speakers.size(); ++i) {
+		auto &l = matrix.left[i];
+		auto &r = matrix.right[i];
+		switch (speakers[i]) {
+		case Speaker::FL:
+			l = 1.0f;
+			break;
+		case Speaker::FR:
+			r = 1.0f;
+			break;
+		case Speaker::FC:
+			l = r = half;
+			break;
+		case Speaker::BL:
+		case Speaker::SL:
+			l = half;
+			break;
+		case Speaker::BR:
+		case Speaker::SR:
+			r = half;
+			break;
+		case Speaker::BC:
+			l = r = 0.5f;
+			break;
+		case Speaker::LFE:
+			break;
+		}
+		leftSum += l;
+		rightSum += r;
+	}
+	for (size_t i = 0; i < speakers.size(); ++i) {
+		matrix.left[i] /= leftSum;
+		matrix.right[i] /= rightSum;
+	}
+	return matrix;
+}
+
+const DownmixMatrix &getDownmixMatrix(int channelCount, ChannelOrder order) noexcept {
+	static const auto matrices = [] {
+		std::array<std::array<DownmixMatrix, LAYOUT_COUNT>, 2> m{};
+		for (int i = 0; i < LAYOUT_COUNT; ++i) {
+			const auto n = static_cast<size_t>(i + MIN_LAYOUT_CHANNEL_COUNT);
+			m[0][static_cast<size_t>(i)] = createDownmixMatrix(std::span(SDL_LAYOUTS[i], n));
+			m[1][static_cast<size_t>(i)] = createDownmixMatrix(std::span(VORBIS_LAYOUTS[i], n));
+		}
+		return m;
+	}();
+	static const DownmixMatrix fallback{{1.0f}, {0.0f, 1.0f}};
+	const auto index = channelCount - MIN_LAYOUT_CHANNEL_COUNT;
+	if (index < 0 || index >= LAYOUT_COUNT) {
+		return fallback;
+	}
+	return matrices[order == ChannelOrder::Vorbis ? 1 : 0][static_cast<size_t>(index)];
+}
+
+} // namespace audio
@@ -0,0 +1,30 @@
+//! ステレオを超えるチャンネル配置からのダウンミックス
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace audio {
+
+/// チャンネルの並び
+///
+/// モノラル・ステレオではどちらも同じである。
+enum class ChannelOrder: uint8_t {
+	Sdl,    // SDL・WAVEの並び (5.1chならFL, FR, FC, LFE, BL, BR)
+	Vorbis, // Vorbisの並び (5.1chならFL, FC, FR, BL, BR, LFE)
+};
+
+/// 各チャンネルを左右へ振り分ける係数
+struct DownmixMatrix {
+	std::array<float, 8> left;
+	std::array<float, 8> right;
+};
+
+/// channelCountチャンネル (3から8) を並びorderとみなしてステレオへ振り分ける係数を取得する関数
+///
+/// ITU-R BS.775に倣い、センターとサラウンドを-3dBで左右へ加え、LFEは捨てる。
+/// クリップしないよう、各出力の係数の和は1に正規化してある。範囲外のchannelCountは先頭2チャンネルのみを使う。
+const DownmixMatrix &getDownmixMatrix(int channelCount, ChannelOrder order) noexcept;
+
+} // namespace audio
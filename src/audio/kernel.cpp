@@ -0,0 +1,169 @@
+#include "kernel.hpp"
+
+#include "simd.hpp"
+
+#include <algorithm>
+
+namespace audio {
+
+void accumulate(float *dst, const float *src, size_t count, float gain) noexcept {
+	size_t i = 0;
+#if defined(AUDIO_SSE2)
+	const auto g = _mm_set1_ps(gain);
+	for (; i + 8 <= count; i += 8) {
+		const auto a = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g));
+		const auto b = _mm_add_ps(_mm_loadu_ps(dst + i + 4), _mm_mul_ps(_mm_loadu_ps(src + i + 4), g));
+		_mm_storeu_ps(dst + i, a);
+		_mm_storeu_ps(dst + i + 4, b);
+	}
+#elif defined(AUDIO_NEON)
+	for (; i + 8 <= count; i += 8) {
+		vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), gain));
+		vst1q_f32(dst + i + 4, vmlaq_n_f32(vld1q_f32(dst + i + 4), vld1q_f32(src + i + 4), gain));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] += src[i] * gain;
+	}
+}
+
+// NOTE: 効果音に多いモノラルをステレオで合成する場合のみ特化する。
+void accumulateMonoToStereo(float *dst, const float *src, uint32_t frameCount, float gain) noexcept {
+	uint32_t i = 0;
+#if defined(AUDIO_SSE2)
+	const auto g = _mm_set1_ps(gain);
+	for (; i + 4 <= frameCount; i += 4) {
+		const auto m = _mm_mul_ps(_mm_loadu_ps(src + i), g);
+		const auto d = dst + i * 2;
+		_mm_storeu_ps(d, _mm_add_ps(_mm_loadu_ps(d), _mm_unpacklo_ps(m, m)));
+		_mm_storeu_ps(d + 4, _mm_add_ps(_mm_loadu_ps(d + 4), _mm_unpackhi_ps(m, m)));
+	}
+#elif defined(AUDIO_NEON)
+	for (; i + 4 <= frameCount; i += 4) {
+		const auto m = vmulq_n_f32(vld1q_f32(src + i), gain);
+		const auto z = vzipq_f32(m, m);
+		const auto d = dst + i * 2;
+		vst1q_f32(d, vaddq_f32(vld1q_f32(d), z.val[0]));
+		vst1q_f32(d + 4, vaddq_f32(vld1q_f32(d + 4), z.val[1]));
+	}
+#endif
+	for (; i < frameCount; ++i) {
+		const auto v = src[i] * gain;
+		dst[i * 2] += v;
+		dst[i * 2 + 1] += v;
+	}
+}
+
+// NOTE: ミキサーの出力はステレオ以下なので、ステレオを超える入力は係数行列で左右へ振り分ける。
+void downmixFrames(
+	float *dst,
+	size_t dstChannelCount,
+	const float *src,
+	size_t srcChannelCount,
+	const DownmixMatrix &matrix,
+	uint32_t frameCount,
+	float gain
+) noexcept {
+	for (size_t i = 0; i < frameCount; ++i) {
+		const auto s = src + i * srcChannelCount;
+		float left = 0.0f;
+		float right = 0.0f;
+		for (size_t c = 0; c < srcChannelCount; ++c) {
+			left += s[c] * matrix.left[c];
+			right += s[c] * matrix.right[c];
+		}
+		if (dstChannelCount == 1) {
+			dst[i] += (left + right) * 0.5f * gain;
+		} else {
+			dst[i * 2] += left * gain;
+			dst[i * 2 + 1] += right * gain;
+		}
+	}
+}
+
+void accumulateFrames(
+	float *dst,
+	int dstChannelCount,
+	const float *src,
+	int srcChannelCount,
+	ChannelOrder srcOrder,
+	uint32_t frameCount,
+	float gain
+) noexcept {
+	const auto dc = static_cast<size_t>(dstChannelCount);
+	const auto sc = static_cast<size_t>(srcChannelCount);
+	if (dc == sc) {
+		accumulate(dst, src, frameCount * dc, gain);
+	} else if (sc == 1 && dc == 2) {
+		accumulateMonoToStereo(dst, src, frameCount, gain);
+	} else if (sc == 1) {
+		for (size_t i = 0; i < frameCount; ++i) {
+			for (size_t c = 0; c < dc; ++c) {
+				dst[i * dc + c] += src[i] * gain;
+			}
+		}
+	} else if (sc > 2 && dc <= 2) {
+		downmixFrames(dst, dc, src, sc, getDownmixMatrix(srcChannelCount, srcOrder), frameCount, gain);
+	} else if (dc == 1) {
+		const auto g = gain / static_cast<float>(sc);
+		for (size_t i = 0; i < frameCount; ++i) {
+			float sum = 0.0f;
+			for (size_t c = 0; c < sc; ++c) {
+				sum += src[i * sc + c];
+			}
+			dst[i] += sum * g;
+		}
+	} else {
+		for (size_t i = 0; i < frameCount; ++i) {
+			for (size_t c = 0; c < std::min(dc, sc); ++c) {
+				dst[i * dc + c] += src[i * sc + c] * gain;
+			}
+		}
+	}
+}
+
+float dot(const float *a, const float *b, size_t count) noexcept {
+	size_t i = 0;
+	float sum = 0.0f;
+#if defined(AUDIO_SSE2)
+	auto acc = _mm_setzero_ps();
+	for (; i + 4 <= count; i += 4) {
+		acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+	}
+	alignas(16) float lanes[4];
+	_mm_store_ps(lanes, acc);
+	sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(AUDIO_NEON)
+	auto acc = vdupq_n_f32(0.0f);
+	for (; i + 4 <= count; i += 4) {
+		acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+	}
+	sum = vaddvq_f32(acc);
+#endif
+	for (; i < count; ++i) {
+		sum += a[i] * b[i];
+	}
+	return sum;
+}
+
+void clampSamples(float *data, size_t count) noexcept {
+	size_t i = 0;
+#if defined(AUDIO_SSE2)
+	const auto lo = _mm_set1_ps(-1.0f);
+	const auto hi = _mm_set1_ps(1.0f);
+	for (; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(data + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), lo), hi));
+	}
+#elif defined(AUDIO_NEON)
+	const auto lo = vdupq_n_f32(-1.0f);
+	const auto hi = vdupq_n_f32(1.0f);
+	for (; i + 4 <= count; i += 4) {
+		vst1q_f32(data + i, vminq_f32(vmaxq_f32(vld1q_f32(data + i), lo), hi));
+	}
+#endif
+	for (; i < count; ++i) {
+		data[i] = std::clamp(data[i], -1.0f, 1.0f);
+	}
+}
+
+} // namespace audio
@@ -0,0 +1,36 @@
+//! ミキサーの内側で使う合成の演算
+
+#pragma once
+
+#include "downmix.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace audio {
+
+/// dst[i] += src[i] * gain
+void accumulate(float *dst, const float *src, size_t count, float gain) noexcept;
+
+/// チャンネル数を揃えながらsrcのframeCountフレームをgain倍してdstへ加算する関数
+///
+/// モノラルは全チャンネルへ複製し、ステレオからモノラルへは左右を平均する。
+/// ステレオを超えるものからステレオ・モノラルへは、srcOrderに従ってダウンミックスする。
+/// それ以外は先頭から対応するチャンネル同士を加算する。
+void accumulateFrames(
+	float *dst,
+	int dstChannelCount,
+	const float *src,
+	int srcChannelCount,
+	ChannelOrder srcOrder,
+	uint32_t frameCount,
+	float gain
+) noexcept;
+
+/// aとbのcount個の要素の内積を求める関数
+float dot(const float *a, const float *b, size_t count) noexcept;
+
+/// 各サンプルを[-1, 1]へ収める関数
+void clampSamples(float *data, size_t count) noexcept;
+
+} // namespace audio
@@ -0,0 +1,34 @@
+#include "load.hpp"
+
+#include "mixer.hpp"
+
+#include <atomic>
+
+namespace audio {
+
+std::atomic<uint64_t> g_decodeTime;
+std::atomic<uint64_t> g_convertTime;
+
+std::shared_ptr<Wave> loadWave(const std::string &file, uint32_t startPosition, const SDL_AudioSpec &spec) {
+	const auto &config = config::config();
+	const auto start = std::chrono::steady_clock::now();
+	auto wave = Wave::fromFile(file, startPosition);
+	const auto decoded = std::chrono::steady_clock::now();
+	if (config.audioConvertOnLoad) {
+		wave = convertWave(std::move(wave), spec, config.audioResamplerQuality);
+	}
+	wave->decodeTime = toNanoseconds(decoded - start);
+	g_decodeTime += wave->decodeTime;
+	g_convertTime += toNanoseconds(std::chrono::steady_clock::now() - decoded);
+	return wave;
+}
+
+uint64_t decodeTime() noexcept {
+	return g_decodeTime;
+}
+
+uint64_t convertTime() noexcept {
+	return g_convertTime;
+}
+
+} // namespace audio
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "wave.hpp"
+
+namespace audio {
+
+/// アセットからWAVEを読み込む関数
+///
+/// configのaudio-convert-on-loadが有効ならspecへ変換する。
+/// スレッドセーフであり、ワーカースレッドから呼んでも良い。
+std::shared_ptr<Wave> loadWave(const std::string &file, uint32_t startPosition, const SDL_AudioSpec &spec);
+
+/// 読込み時のデコードに要した総時間 (ナノ秒)
+uint64_t decodeTime() noexcept;
+
+/// 読込み時の変換に要した総時間 (ナノ秒)
+uint64_t convertTime() noexcept;
+
+} // namespace audio
@@ -0,0 +1,138 @@
+#include "mixer.hpp"
+
+#include "kernel.hpp"
+
+#include <algorithm>
+
+namespace audio {
+
+// NOTE: 合成は要求された分だけ行い先回りしないので、呼ばれた時点のストリームは常に空である。
+//       したがってadditionalAmountとtotalAmountは常に等しく、これらからアンダーランを判定することはできない。
+void SDLCALL mixVoices(void *userdata, SDL_AudioStream *, int additionalAmount, int) {
+	static_cast<Mixer *>(userdata)->mix(additionalAmount);
+}
+
+SDL_AudioSpec getMixSpec(SDL_AudioDeviceID device) {
+	SDL_AudioSpec spec;
+	if (!SDL_GetAudioDeviceFormat(device, &spec, nullptr)) {
+		throw "failed to get the format of the audio device.";
+	}
+	// NOTE: ステレオを超えるチャンネル配置への振り分けはSDLに任せる。
+	return SDL_AudioSpec{SDL_AUDIO_F32, std::min(spec.channels, 2), spec.freq};
+}
+
+int getDeviceFrameCount(SDL_AudioDeviceID device) noexcept {
+	SDL_AudioSpec spec;
+	int frameCount = 0;
+	return SDL_GetAudioDeviceFormat(device, &spec, &frameCount) ? frameCount : 0;
+}
+
+Mixer::Mixer(SDL_AudioDeviceID device, uint32_t voiceCount, uint32_t logInterval):
+	_spec(getMixSpec(device)),
+	_deviceFrameCount(getDeviceFrameCount(device)),
+	_stream(SDL_CreateAudioStream(&_spec, nullptr), SDL_DestroyAudioStream),
+	_voices(voiceCount),
+	_block(MIX_BLOCK_FRAME_COUNT * static_cast<size_t>(_spec.channels)),
+	_scratch(std::make_unique<MixScratch>()),
+	_mixOverrunCount(0),
+	_callbackGapCount(0),
+	_mixTime(0),
+	_lastMixDuration(0),
+	_logInterval(static_cast<uint64_t>(logInterval) * static_cast<uint64_t>(_spec.freq)),
+	_logFrameCount(0),
+	_logMixTime(0)
+{
+	if (!_stream) {
+		throw "failed to create an audio stream.";
+	}
+	if (!SDL_SetAudioStreamGetCallback(_stream.get(), mixVoices, this)) {
+		throw "failed to set the callback of an audio stream.";
+	}
+	if (!SDL_BindAudioStream(device, _stream.get())) {
+		throw "failed to bind an audio stream to the device.";
+	}
+}
+
+// NOTE: どちらもアンダーランそのものではなく、その兆候を数える。
+//       合成に要した時間が合成した音声の長さを超えれば、それが続くと再生に間に合わなくなる。
+//       前回の合成から前回合成した音声の長さの2倍を超えて間が空けば、デバイスへの供給が途切れた可能性がある。
+//       ただしデバイスが一度に読み出す量が変わった場合にも数えられる。
+void Mixer::_record(Clock::time_point start, uint32_t frameCount) noexcept {
+	if (frameCount == 0) {
+		return;
+	}
+	const auto elapsed = toNanoseconds(Clock::now() - start);
+	const auto duration = static_cast<uint64_t>(frameCount) * 1'000'000'000 / static_cast<uint64_t>(_spec.freq);
+	_mixTime += elapsed;
+	if (elapsed > duration) {
+		_mixOverrunCount += 1;
+	}
+	if (_lastMixDuration > 0 && toNanoseconds(start - _lastMixStart) > _lastMixDuration * 2) {
+		_callbackGapCount += 1;
+	}
+	_lastMixStart = start;
+	_lastMixDuration = duration;
+
+	if (_logInterval == 0) {
+		return;
+	}
+	_logFrameCount += frameCount;
+	_logMixTime += elapsed;
+	if (_logFrameCount < _logInterval) {
+		return;
+	}
+	// NOTE: 負荷は合成に要した時間の、合成した音声の長さに対する割合。
+	const auto s = statistics();
+	const auto logDuration = static_cast<double>(_logFrameCount) / static_cast<double>(_spec.freq);
+	const auto load = static_cast<double>(_logMixTime) / 1e9 / logDuration;
+	SDL_Log(
+		"audio: load %.2f%%, mix overruns %" SDL_PRIu64 ", callback gaps %" SDL_PRIu64 ", queued %" SDL_PRIu64
+			" bytes, latency %.2f ms",
+		load * 100.0,
+		s.mixOverrunCount,
+		s.callbackGapCount,
+		s.queuedSize,
+		static_cast<double>(s.latency) / 1e6
+	);
+	_logFrameCount = 0;
+	_logMixTime = 0;
+}
+
+MixerStatistics Mixer::statistics() const noexcept {
+	const auto frameSize = static_cast<uint64_t>(_spec.channels) * sizeof(float);
+	const auto queued = static_cast<uint64_t>(std::max(SDL_GetAudioStreamQueued(_stream.get()), 0));
+	const auto frameCount = queued / frameSize + static_cast<uint64_t>(_deviceFrameCount);
+	return MixerStatistics{
+		queued,
+		_mixOverrunCount,
+		_callbackGapCount,
+		_mixTime,
+		frameCount * 1'000'000'000 / static_cast<uint64_t>(_spec.freq),
+	};
+}
+
+void Mixer::mix(int amount) noexcept {
+	const auto start = Clock::now();
+	const auto channelCount = static_cast<uint32_t>(_spec.channels);
+	const auto frameSize = channelCount * static_cast<uint32_t>(sizeof(float));
+	const auto totalFrameCount = (static_cast<uint32_t>(std::max(amount, 0)) + frameSize - 1) / frameSize;
+	auto frameCount = totalFrameCount;
+	while (frameCount > 0) {
+		const auto count = std::min(frameCount, MIX_BLOCK_FRAME_COUNT);
+		const auto sampleCount = static_cast<size_t>(count * channelCount);
+		std::fill_n(_block.begin(), sampleCount, 0.0f);
+		for (auto &n: _voices) {
+			if (n.playing()) {
+				n.mix(_block.data(), count, _spec.channels, *_scratch);
+			}
+		}
+		clampSamples(_block.data(), sampleCount);
+		if (!SDL_PutAudioStreamData(_stream.get(), _block.data(), static_cast<int>(sampleCount * sizeof(float)))) {
+			break;
+		}
+		frameCount -= count;
+	}
+	_record(start, totalFrameCount - frameCount);
+}
+
+} // namespace audio
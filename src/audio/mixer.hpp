@@ -0,0 +1,96 @@
+#pragma once
+
+#include "../error/error.hpp"
+#include "voice.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace audio {
+
+inline uint64_t toNanoseconds(std::chrono::steady_clock::duration duration) noexcept {
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+struct MixerStatistics {
+	uint64_t queuedSize;        // ストリームに溜まっていてデバイスへ送られていないデータのサイズ (バイト数)
+	uint64_t mixOverrunCount;   // 合成に要した時間が合成した音声の長さを超えた回数
+	uint64_t callbackGapCount;  // 前回の合成からの間隔が前回合成した音声の長さの2倍を超えた回数
+	uint64_t mixTime;           // 合成に要した総時間 (ナノ秒)
+	uint64_t latency;           // 現在合成したフレームが再生されるまでの時間 (ナノ秒)
+};
+
+/// 全ボイスを1つの形式で合成し、デバイスへ束縛した1本のストリームへ送るクラス
+///
+/// 合成はストリームのコールバックとしてオーディオスレッドで行われる。
+/// ボイスを変更する間はロックすること (BasicLockableなのでstd::lock_guardを使える)。
+class Mixer {
+private:
+	using Stream = std::unique_ptr<SDL_AudioStream, decltype(&SDL_DestroyAudioStream)>;
+
+	using Clock = std::chrono::steady_clock;
+
+	SDL_AudioSpec _spec;
+	int _deviceFrameCount; // デバイスのバッファのフレーム数
+	Stream _stream;
+	std::vector<Voice> _voices;
+	std::vector<float> _block;
+	const std::unique_ptr<MixScratch> _scratch;
+	std::atomic<uint64_t> _mixOverrunCount;
+	std::atomic<uint64_t> _callbackGapCount;
+	std::atomic<uint64_t> _mixTime;
+	Clock::time_point _lastMixStart; // 以下はオーディオスレッドのみが触る
+	uint64_t _lastMixDuration;       // 前回合成した音声の長さ (ナノ秒)
+	const uint64_t _logInterval;     // 統計値をログに出力する間隔 (フレーム数)。0なら出力しない
+	uint64_t _logFrameCount;
+	uint64_t _logMixTime;
+
+	void _record(Clock::time_point start, uint32_t frameCount) noexcept;
+
+public:
+	Mixer(const Mixer &) = delete;
+	Mixer &operator =(const Mixer &) = delete;
+
+	/// NOTE: デバイスを閉じるまで破棄しないこと。
+	///
+	/// logIntervalは統計値をログに出力する間隔 (秒) であり、0なら出力しない。
+	Mixer(SDL_AudioDeviceID device, uint32_t voiceCount, uint32_t logInterval);
+
+	/// 合成する形式 (常に32bit浮動小数点)
+	const SDL_AudioSpec &spec() const noexcept {
+		return _spec;
+	}
+
+	Voice &voice(uint32_t index) {
+		return error::atMut(_voices, index, "channels");
+	}
+
+	const Voice &voice(uint32_t index) const {
+		return error::at(_voices, index, "channels");
+	}
+
+	std::vector<Voice> &voices() noexcept {
+		return _voices;
+	}
+
+	/// 統計値を取得する関数
+	///
+	/// ロックせずに呼んでも良い。
+	MixerStatistics statistics() const noexcept;
+
+	void lock() noexcept {
+		SDL_LockAudioStream(_stream.get());
+	}
+
+	void unlock() noexcept {
+		SDL_UnlockAudioStream(_stream.get());
+	}
+
+	/// 少なくともamountバイト分を合成してストリームへ送る関数
+	///
+	/// オーディオスレッドから呼ばれる。
+	void mix(int amount) noexcept;
+};
+
+} // namespace audio
@@ -0,0 +1,72 @@
+#include "ogg.hpp"
+
+#include "_stb_vorbis.h"
+
+#include <charconv>
+#include <format>
+#include <string_view>
+
+namespace audio {
+
+void OggDecoder::Closer::operator ()(stb_vorbis *vorbis) const noexcept {
+	stb_vorbis_close(vorbis);
+}
+
+OggDecoder::OggDecoder(const std::string &file, std::span<const unsigned char> ogg):
+	_vorbis(nullptr),
+	_spec{},
+	_frameCount(0),
+	_loopStart(0),
+	_hasLoopStart(false)
+{
+	// NOTE: MSVCの警告を逃れるため。
+	const auto oggSize = static_cast<int>(static_cast<uint32_t>(ogg.size()));
+
+	// ファイルオープン
+	int error;
+	_vorbis.reset(stb_vorbis_open_memory(ogg.data(), oggSize, &error, nullptr));
+	if (!_vorbis) {
+		throw std::format("failed to open '{}': {}", file, error);
+	}
+
+	// 情報取得
+	const auto info = stb_vorbis_get_info(_vorbis.get());
+	if (info.channels <= 0 || info.sample_rate == 0) {
+		throw std::format("the ogg file '{}' is invalid.", file);
+	}
+	_spec = SDL_AudioSpec{SDL_AUDIO_F32, info.channels, static_cast<int>(info.sample_rate)};
+	_frameCount = stb_vorbis_stream_length_in_samples(_vorbis.get());
+
+	// ループ開始位置取得
+	const auto comment = stb_vorbis_get_comment(_vorbis.get());
+	for (int i = 0; i < comment.comment_list_length; ++i) {
+		const std::string_view ct(comment.comment_list[i]);
+		if (!ct.starts_with("LOOPSTART=")) {
+			continue;
+		}
+		const auto ctv = ct.substr(10);
+		size_t lsv;
+		const auto [p, e] = std::from_chars(ctv.data(), ctv.data() + ctv.size(), lsv);
+		if (e == std::errc{}) {
+			_loopStart = static_cast<uint32_t>(lsv);
+			_hasLoopStart = true;
+			break;
+		}
+	}
+}
+
+uint32_t OggDecoder::read(float *dst, uint32_t frameCount) noexcept {
+	const auto decoded = stb_vorbis_get_samples_float_interleaved(
+		_vorbis.get(),
+		_spec.channels,
+		dst,
+		static_cast<int>(frameCount * static_cast<uint32_t>(_spec.channels))
+	);
+	return decoded > 0 ? static_cast<uint32_t>(decoded) : 0;
+}
+
+void OggDecoder::seek(uint32_t frame) noexcept {
+	stb_vorbis_seek(_vorbis.get(), frame < _frameCount ? frame : 0);
+}
+
+} // namespace audio
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <SDL3/SDL_audio.h>
+#include <span>
+#include <string>
+
+struct stb_vorbis;
+
+namespace audio {
+
+/// メモリ上のOggを少しずつデコードするクラス
+///
+/// デコード結果は32bit浮動小数点のインターリーブされたPCMである。
+class OggDecoder {
+private:
+	struct Closer {
+		void operator ()(stb_vorbis *vorbis) const noexcept;
+	};
+
+	std::unique_ptr<stb_vorbis, Closer> _vorbis;
+	SDL_AudioSpec _spec;
+	uint32_t _frameCount;
+	uint32_t _loopStart;
+	bool _hasLoopStart;
+
+public:
+	/// NOTE: oggは破棄されるまで有効であること。
+	OggDecoder(const std::string &file, std::span<const unsigned char> ogg);
+
+	const SDL_AudioSpec &spec() const noexcept {
+		return _spec;
+	}
+
+	uint32_t frameCount() const noexcept {
+		return _frameCount;
+	}
+
+	/// コメントのLOOPSTARTで指定されたループ開始位置 (なければdefaultValue)
+	uint32_t loopStart(uint32_t defaultValue) const noexcept {
+		return _hasLoopStart ? _loopStart : defaultValue;
+	}
+
+	/// 最大frameCountフレームをdstへデコードする関数
+	///
+	/// デコードしたフレーム数を返す。終端に達していれば0を返す。
+	uint32_t read(float *dst, uint32_t frameCount) noexcept;
+
+	/// 次にデコードする位置をframeへ移す関数
+	///
+	/// サンプル単位で正確に移動する。
+	void seek(uint32_t frame) noexcept;
+};
+
+} // namespace audio
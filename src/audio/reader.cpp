@@ -0,0 +1,67 @@
+#include "reader.hpp"
+
+#include "convert.hpp"
+
+#include <algorithm>
+
+namespace audio {
+
+void WaveReader::reset(const Wave *wave, std::shared_ptr<OggStream> stream, bool loop) noexcept {
+	_wave = wave;
+	_stream = std::move(stream);
+	_frameSize = wave ? static_cast<uint32_t>(SDL_AUDIO_FRAMESIZE(wave->spec)) : 0;
+	_frameCount = _frameSize > 0 ? static_cast<uint32_t>(wave->data.size() / _frameSize) : 0;
+	if (wave && wave->adpcm.blockSize > 0) {
+		_adpcm.reset(*wave);
+		_frameCount = wave->adpcm.frameCount;
+	}
+	_loopStart = wave ? wave->startPosition : 0;
+	_position = 0;
+	_loop = loop;
+}
+
+uint32_t WaveReader::_readPcm(float *dst, uint32_t frameCount) noexcept {
+	const auto count = std::min(frameCount, _frameCount - _position);
+	const auto src = _wave->data.data() + static_cast<size_t>(_position) * _frameSize;
+	const auto sampleCount = static_cast<size_t>(count) * static_cast<size_t>(_wave->spec.channels);
+	convertToFloat(src, _wave->spec.format, dst, sampleCount);
+	_position += count;
+	return count;
+}
+
+uint32_t WaveReader::read(float *dst, uint32_t frameCount) noexcept {
+	if (!_wave) {
+		return 0;
+	}
+	if (_stream) {
+		return _stream->read(dst, frameCount);
+	}
+	const auto channelCount = static_cast<uint32_t>(_wave->spec.channels);
+	const auto adpcm = _wave->adpcm.blockSize > 0;
+	uint32_t done = 0;
+	bool rewound = false;
+	while (done < frameCount) {
+		const auto n = adpcm ? _adpcm.read(dst + done * channelCount, frameCount - done)
+			: _readPcm(dst + done * channelCount, frameCount - done);
+		if (n > 0) {
+			done += n;
+			rewound = false;
+			continue;
+		}
+
+		// NOTE: 終端に達したらループ開始位置へ戻る。
+		//       戻った直後にも読めなければループ区間が空なので諦める。
+		if (!_loop || rewound) {
+			break;
+		}
+		if (adpcm) {
+			_adpcm.seek(_loopStart);
+		} else {
+			_position = _loopStart < _frameCount ? _loopStart : 0;
+		}
+		rewound = true;
+	}
+	return done;
+}
+
+} // namespace audio
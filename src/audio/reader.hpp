@@ -0,0 +1,43 @@
+#pragma once
+
+#include "adpcm.hpp"
+#include "stream.hpp"
+
+namespace audio {
+
+/// Waveを先頭から順に32bit浮動小数点のPCMとして読み出すクラス
+///
+/// ループする場合、終端に達するとループ開始位置へ戻って読み続けるので、読み出した列は継ぎ目なく続く。
+class WaveReader {
+private:
+	const Wave *_wave;
+	std::shared_ptr<OggStream> _stream;   // _waveをストリーミング再生する場合のみ
+	AdpcmDecoder _adpcm;                  // _waveがIMA ADPCMの場合のみ使う
+	uint32_t _frameSize;
+	uint32_t _frameCount;
+	uint32_t _loopStart;
+	uint32_t _position;
+	bool _loop;
+
+	uint32_t _readPcm(float *dst, uint32_t frameCount) noexcept;
+
+public:
+	WaveReader(const WaveReader &) = delete;
+	WaveReader &operator =(const WaveReader &) = delete;
+
+	WaveReader(): _wave(nullptr), _frameSize(0), _frameCount(0), _loopStart(0), _position(0), _loop(false) {}
+
+	/// waveを先頭から読み出すよう設定する関数
+	///
+	/// waveは次にreset()するまで有効であること。
+	/// streamはwaveをストリーミング再生する場合のみ指定する (ループはstream側で扱う)。
+	void reset(const Wave *wave, std::shared_ptr<OggStream> stream, bool loop) noexcept;
+
+	/// 最大frameCountフレームをdstへ読み出す関数
+	///
+	/// 読み出したフレーム数を返す。
+	/// ループしない場合、終端に達するとframeCount未満を返す。
+	uint32_t read(float *dst, uint32_t frameCount) noexcept;
+};
+
+} // namespace audio
@@ -0,0 +1,99 @@
+#include "resampler.hpp"
+
+#include "kernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace audio {
+
+// NOTE: 入力フレーム間の位置を量子化する段階数。
+constexpr uint64_t PHASE_COUNT = 256;
+
+uint32_t getTapCount(config::ResamplerQuality quality) noexcept {
+	switch (quality) {
+	case config::ResamplerQuality::Low:
+		return 2;
+	case config::ResamplerQuality::Medium:
+		return 8;
+	case config::ResamplerQuality::High:
+		return 32;
+	default:
+		return 8;
+	}
+}
+
+// NOTE: 出力位置から入力フレームまでの距離xにおける係数。
+float calcCoefficient(double x, uint32_t tapCount, double cutoff) noexcept {
+	if (tapCount == 2) {
+		return static_cast<float>(std::max(0.0, 1.0 - std::abs(x)));
+	}
+	const auto half = static_cast<double>(tapCount) / 2.0;
+	if (std::abs(x) >= half) {
+		return 0.0f;
+	}
+	constexpr auto pi = std::numbers::pi;
+	const auto t = pi * cutoff * x;
+	const auto sinc = t == 0.0 ? 1.0 : std::sin(t) / t;
+	const auto window = 0.42 + 0.5 * std::cos(pi * x / half) + 0.08 * std::cos(2.0 * pi * x / half); // Blackman
+	return static_cast<float>(cutoff * sinc * window);
+}
+
+Resampler::Resampler(int srcFrequency, int dstFrequency, config::ResamplerQuality quality):
+	_tapCount(getTapCount(quality)),
+	_srcFrequency(static_cast<uint64_t>(srcFrequency)),
+	_dstFrequency(static_cast<uint64_t>(dstFrequency)),
+	_step((_srcFrequency << 32) / _dstFrequency),
+	_coefficients(PHASE_COUNT * _tapCount)
+{
+	// NOTE: ダウンサンプリングではエイリアシングを防ぐため、出力のナイキスト周波数で帯域を制限する。
+	const auto cutoff = std::min(1.0, static_cast<double>(_dstFrequency) / static_cast<double>(_srcFrequency));
+	for (uint64_t p = 0; p < PHASE_COUNT; ++p) {
+		const auto coefficients = _coefficients.data() + p * _tapCount;
+		const auto frac = static_cast<double>(p) / static_cast<double>(PHASE_COUNT);
+		float sum = 0.0f;
+		for (uint32_t k = 0; k < _tapCount; ++k) {
+			const auto x = static_cast<double>(k) - static_cast<double>(_tapCount / 2 - 1) - frac;
+			coefficients[k] = calcCoefficient(x, _tapCount, cutoff);
+			sum += coefficients[k];
+		}
+		// NOTE: 直流成分の利得を1にする。
+		for (uint32_t k = 0; k < _tapCount; ++k) {
+			coefficients[k] /= sum;
+		}
+	}
+}
+
+size_t Resampler::calcFrameCount(size_t srcFrameCount) const noexcept {
+	if (srcFrameCount == 0) {
+		return 0;
+	}
+	return std::max<size_t>(static_cast<size_t>(srcFrameCount * _dstFrequency / _srcFrequency), 1);
+}
+
+uint32_t Resampler::convertPosition(uint32_t position) const noexcept {
+	return static_cast<uint32_t>(position * _dstFrequency / _srcFrequency);
+}
+
+void Resampler::process(const float *src, int channelCount, size_t srcFrameCount, float *dst) const {
+	const auto cc = static_cast<size_t>(channelCount);
+	const auto dstFrameCount = calcFrameCount(srcFrameCount);
+
+	// NOTE: 端でも全タップを読めるよう、前後をタップ数の半分ずつ無音で埋めたチャンネルごとの列にする。
+	//       入力位置indexに対するタップはplanar[index + 1]から始まる。
+	std::vector<float> planar(srcFrameCount + _tapCount);
+	for (size_t c = 0; c < cc; ++c) {
+		for (size_t i = 0; i < srcFrameCount; ++i) {
+			planar[_tapCount / 2 + i] = src[i * cc + c];
+		}
+		for (size_t j = 0; j < dstFrameCount; ++j) {
+			const auto position = static_cast<uint64_t>(j) * _step;
+			const auto index = static_cast<size_t>(position >> 32);
+			const auto phase = static_cast<size_t>((position & 0xFFFFFFFF) * PHASE_COUNT >> 32);
+			dst[j * cc + c] = dot(planar.data() + index + 1, _coefficients.data() + phase * _tapCount, _tapCount);
+		}
+	}
+}
+
+} // namespace audio
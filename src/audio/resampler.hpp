@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../config/config.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace audio {
+
+/// 窓付きsincによるポリフェーズのリサンプラー
+///
+/// 品質によってタップ数が変わる。Lowは2タップの線形補間である。
+/// 読込み時の変換に使うものであり、合成時のリサンプリングには使わない。
+class Resampler {
+private:
+	uint32_t _tapCount;
+	uint64_t _srcFrequency;
+	uint64_t _dstFrequency;
+	uint64_t _step;                   // 出力1フレームあたりに進む入力フレーム数 (32.32固定小数点)
+	std::vector<float> _coefficients; // 位相ごとに_tapCount個並ぶ
+
+public:
+	Resampler(int srcFrequency, int dstFrequency, config::ResamplerQuality quality);
+
+	/// srcFrameCountフレームを変換した後のフレーム数
+	size_t calcFrameCount(size_t srcFrameCount) const noexcept;
+
+	/// 入力のフレーム位置を出力のフレーム位置へ変換する関数
+	uint32_t convertPosition(uint32_t position) const noexcept;
+
+	/// インターリーブされたsrcを変換してdstへ書き込む関数
+	///
+	/// dstはcalcFrameCount(srcFrameCount)フレーム分の大きさがあること。
+	void process(const float *src, int channelCount, size_t srcFrameCount, float *dst) const;
+};
+
+} // namespace audio
@@ -0,0 +1,132 @@
+#include "riff.hpp"
+
+#include <algorithm>
+#include <imaadpcm.hpp>
+#include <string_view>
+
+namespace audio {
+
+constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+uint16_t read16(std::span<const unsigned char> src, size_t offset) {
+	return static_cast<uint16_t>(src[offset] | src[offset + 1] << 8);
+}
+
+uint32_t read32(std::span<const unsigned char> src, size_t offset) {
+	return static_cast<uint32_t>(read16(src, offset)) | static_cast<uint32_t>(read16(src, offset + 2)) << 16;
+}
+
+bool isFourCC(std::span<const unsigned char> src, size_t offset, std::string_view id) {
+	return std::string_view(reinterpret_cast<const char *>(src.data() + offset), 4) == id;
+}
+
+std::optional<SDL_AudioFormat> convertFormat(uint16_t tag, uint16_t bits) {
+	if (tag == WAVE_FORMAT_PCM && bits == 8) {
+		return SDL_AUDIO_U8;
+	} else if (tag == WAVE_FORMAT_PCM && bits == 16) {
+		return SDL_AUDIO_S16LE;
+	} else if (tag == WAVE_FORMAT_PCM && bits == 32) {
+		return SDL_AUDIO_S32LE;
+	} else if (tag == WAVE_FORMAT_IEEE_FLOAT && bits == 32) {
+		return SDL_AUDIO_F32LE;
+	} else {
+		return std::nullopt;
+	}
+}
+
+std::optional<RiffWave> parseRiffWave(std::span<const unsigned char> src) {
+	if (src.size() < 12 || !isFourCC(src, 0, "RIFF") || !isFourCC(src, 8, "WAVE")) {
+		return std::nullopt;
+	}
+
+	std::optional<SDL_AudioSpec> spec;
+	uint16_t blockAlign = 0;
+	AdpcmLayout adpcm{};
+	std::optional<uint32_t> factFrameCount;
+	size_t offset = 12;
+	while (src.size() - offset >= 8) {
+		const auto size = static_cast<size_t>(read32(src, offset + 4));
+		const auto body = offset + 8;
+
+		// fmtチャンク
+		if (isFourCC(src, offset, "fmt ")) {
+			if (size < 16 || src.size() - body < size) {
+				return std::nullopt;
+			}
+			auto tag = read16(src, body);
+			const auto channels = read16(src, body + 2);
+			const auto freq = read32(src, body + 4);
+			blockAlign = read16(src, body + 12);
+			const auto bits = read16(src, body + 14);
+			// NOTE: WAVE_FORMAT_EXTENSIBLEの場合、実際の形式はサブフォーマットGUIDの先頭2バイトにある。
+			if (tag == WAVE_FORMAT_EXTENSIBLE) {
+				if (size < 40) {
+					return std::nullopt;
+				}
+				tag = read16(src, body + 24);
+			}
+			if (channels == 0 || freq == 0) {
+				return std::nullopt;
+			}
+			// NOTE: IMA ADPCMのブロックは、チャンネルごとの4バイトのヘッダーと4バイトずつのまとまりからなる。
+			if (tag == ima::WAVE_FORMAT_IMA_ADPCM) {
+				const auto groupSize = ima::HEADER_SIZE * channels;
+				const auto aligned = blockAlign > groupSize && blockAlign % groupSize == 0;
+				if (bits != 4 || channels > MAX_CHANNEL_COUNT || !aligned) {
+					return std::nullopt;
+				}
+				spec = SDL_AudioSpec{SDL_AUDIO_S16, channels, static_cast<int>(freq)};
+				adpcm.blockSize = blockAlign;
+			} else {
+				const auto format = convertFormat(tag, bits);
+				if (!format || blockAlign != channels * bits / 8) {
+					return std::nullopt;
+				}
+				spec = SDL_AudioSpec{*format, channels, static_cast<int>(freq)};
+			}
+		}
+
+		// factチャンク
+		else if (isFourCC(src, offset, "fact")) {
+			if (size >= 4 && src.size() - body >= 4) {
+				factFrameCount = read32(src, body);
+			}
+		}
+
+		// dataチャンク
+		// NOTE: 末尾が切れているファイルもあるので、残りのサイズに丸める。
+		else if (isFourCC(src, offset, "data")) {
+			if (!spec) {
+				return std::nullopt;
+			}
+			auto length = std::min(size, src.size() - body);
+			if (adpcm.blockSize == 0) {
+				length -= length % blockAlign;
+				return RiffWave{*spec, src.subspan(body, length), adpcm};
+			}
+			// NOTE: IMA ADPCMの末尾のブロックは短くても良い。
+			const auto channelCount = static_cast<uint32_t>(spec->channels);
+			const auto groupSize = ima::HEADER_SIZE * channelCount;
+			const auto blockFrameCount = ima::calcBlockFrameCount(adpcm.blockSize, channelCount);
+			length -= length % groupSize;
+			const auto rest = static_cast<uint32_t>(length % adpcm.blockSize);
+			const auto frameCount = static_cast<uint64_t>(length / adpcm.blockSize) * blockFrameCount
+				+ (rest > 0 ? ima::calcBlockFrameCount(rest, channelCount) : 0);
+			const auto maxFrameCount = static_cast<uint64_t>(factFrameCount.value_or(UINT32_MAX));
+			adpcm.frameCount = static_cast<uint32_t>(std::min(frameCount, maxFrameCount));
+			return RiffWave{*spec, src.subspan(body, length), adpcm};
+		}
+
+		// NOTE: チャンクは2バイト境界に揃えられる。
+		const auto next = static_cast<uint64_t>(body) + size + (size & 1);
+		if (next > src.size()) {
+			break;
+		}
+		offset = static_cast<size_t>(next);
+	}
+	return std::nullopt;
+}
+
+} // namespace audio
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "wave.hpp"
+
+#include <optional>
+#include <SDL3/SDL_audio.h>
+#include <span>
+
+namespace audio {
+
+struct RiffWave {
+	SDL_AudioSpec spec;
+	std::span<const unsigned char> data;
+	AdpcmLayout adpcm; // IMA ADPCMでなければblockSizeは0
+};
+
+/// RIFF WAVEを解析する関数
+///
+/// dataはsrcの一部を指す。
+/// 非圧縮PCM (8/16/32bit整数、32bit浮動小数点) とIMA ADPCMのみに対応し、それ以外はstd::nulloptを返す。
+/// IMA ADPCMの場合、specは復号後のS16を表し、フレーム数はdataチャンクより前のfactチャンクがあればそれに従う。
+std::optional<RiffWave> parseRiffWave(std::span<const unsigned char> src);
+
+} // namespace audio
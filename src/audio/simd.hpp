@@ -0,0 +1,13 @@
+//! SIMD命令セットの判定
+//!
+//! x86-64ではSSE2、AArch64ではNEONを用いる。どちらでもなければスカラーで計算する。
+
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64)
+# define AUDIO_SSE2
+# include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+# define AUDIO_NEON
+# include <arm_neon.h>
+#endif
@@ -0,0 +1,115 @@
+#include "stream.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace audio {
+
+// NOTE: 48kHzならバッファは約170msなので、10msごとに満たせば十分に間に合う。
+constexpr auto STREAM_FILL_INTERVAL = std::chrono::milliseconds(10);
+
+OggStream::OggStream(const std::string &file, std::shared_ptr<Wave> wave, bool loop):
+	_wave(std::move(wave)),
+	_decoder(file, _wave->data),
+	_channelCount(static_cast<uint32_t>(_decoder.spec().channels)),
+	_loopStart(_wave->startPosition),
+	_loop(loop),
+	_rewound(false),
+	_buffer(static_cast<size_t>(STREAM_BUFFER_FRAME_COUNT) * _channelCount),
+	_readPosition(0),
+	_writePosition(0),
+	_ended(false)
+{
+	fill();
+}
+
+void OggStream::fill() noexcept {
+	if (_ended.load(std::memory_order_relaxed)) {
+		return;
+	}
+	const auto read = _readPosition.load(std::memory_order_acquire);
+	auto write = _writePosition.load(std::memory_order_relaxed);
+	while (write - read < STREAM_BUFFER_FRAME_COUNT) {
+		// NOTE: 折り返さない範囲ずつデコードする。
+		const auto offset = write & (STREAM_BUFFER_FRAME_COUNT - 1);
+		const auto count = std::min(STREAM_BUFFER_FRAME_COUNT - (write - read), STREAM_BUFFER_FRAME_COUNT - offset);
+		const auto n = _decoder.read(_buffer.data() + static_cast<size_t>(offset) * _channelCount, count);
+		if (n > 0) {
+			write += n;
+			_writePosition.store(write, std::memory_order_release);
+			_rewound = false;
+			continue;
+		}
+
+		// NOTE: 戻った直後にも読めなければループ区間が空なので諦める。
+		if (!_loop || _rewound) {
+			_ended.store(true, std::memory_order_release);
+			return;
+		}
+		_decoder.seek(_loopStart);
+		_rewound = true;
+	}
+}
+
+uint32_t OggStream::read(float *dst, uint32_t frameCount) noexcept {
+	// NOTE: 終端に達したかを先に読むことで、その時点までに書かれたフレームを必ず読み切る。
+	const auto ended = _ended.load(std::memory_order_acquire);
+	const auto write = _writePosition.load(std::memory_order_acquire);
+	const auto read = _readPosition.load(std::memory_order_relaxed);
+	const auto count = std::min(frameCount, write - read);
+	for (uint32_t done = 0; done < count;) {
+		const auto offset = (read + done) & (STREAM_BUFFER_FRAME_COUNT - 1);
+		const auto n = std::min(count - done, STREAM_BUFFER_FRAME_COUNT - offset);
+		std::copy_n(
+			_buffer.data() + static_cast<size_t>(offset) * _channelCount,
+			static_cast<size_t>(n) * _channelCount,
+			dst + static_cast<size_t>(done) * _channelCount
+		);
+		done += n;
+	}
+	_readPosition.store(read + count, std::memory_order_release);
+	if (count == frameCount || ended) {
+		return count;
+	}
+	std::fill_n(dst + static_cast<size_t>(count) * _channelCount, (frameCount - count) * _channelCount, 0.0f);
+	return frameCount;
+}
+
+Streamer::Streamer(): _stop(false), _thread([this]() { _run(); }) {}
+
+Streamer::~Streamer() {
+	{
+		std::lock_guard lock(_mutex);
+		_stop = true;
+	}
+	_cv.notify_all();
+	_thread.join();
+}
+
+void Streamer::add(const std::shared_ptr<OggStream> &stream) {
+	std::lock_guard lock(_mutex);
+	std::erase_if(_streams, [](const auto &n) { return n.expired(); });
+	_streams.push_back(stream);
+}
+
+void Streamer::_run() {
+	std::vector<std::shared_ptr<OggStream>> streams;
+	std::unique_lock lock(_mutex);
+	while (!_stop) {
+		// NOTE: デコードの間にadd()を待たせないよう、ロックを外してから満たす。
+		for (const auto &n: _streams) {
+			if (auto stream = n.lock()) {
+				streams.push_back(std::move(stream));
+			}
+		}
+		lock.unlock();
+		for (const auto &n: streams) {
+			n->fill();
+		}
+		streams.clear();
+		lock.lock();
+		_cv.wait_for(lock, STREAM_FILL_INTERVAL, [this]() { return _stop; });
+	}
+}
+
+} // namespace audio
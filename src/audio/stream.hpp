@@ -0,0 +1,73 @@
+#pragma once
+
+#include "ogg.hpp"
+#include "wave.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace audio {
+
+/// ストリーミング再生で先読みするフレーム数 (2の累乗)
+constexpr uint32_t STREAM_BUFFER_FRAME_COUNT = 8192;
+
+/// ストリーミング再生するOggを先読みしておくリングバッファ
+///
+/// fill()はストリーミングスレッドが、read()はオーディオスレッドが呼ぶ (それぞれ1スレッドのみ)。
+/// オーディオスレッドはデコードせずにバッファから写すだけなので、デコードの負荷が合成の締切りに影響しない。
+/// ループする場合、終端に達するとLOOPSTARTへサンプル単位で正確に戻ってデコードし続ける。
+class OggStream {
+private:
+	const std::shared_ptr<Wave> _wave; // _decoderが参照するデータを保持する
+	OggDecoder _decoder;
+	const uint32_t _channelCount;
+	const uint32_t _loopStart;
+	const bool _loop;
+	bool _rewound; // 以下はfill()のみが触る
+	std::vector<float> _buffer;
+	std::atomic<uint32_t> _readPosition;  // 読み出したフレーム数 (オーディオスレッドのみが進める)
+	std::atomic<uint32_t> _writePosition; // デコードしたフレーム数 (ストリーミングスレッドのみが進める)
+	std::atomic<bool> _ended;             // 終端までデコードし終えたか
+
+public:
+	OggStream(const OggStream &) = delete;
+	OggStream &operator =(const OggStream &) = delete;
+
+	/// NOTE: 再生開始時に途切れないよう、ここでバッファを満たす。
+	OggStream(const std::string &file, std::shared_ptr<Wave> wave, bool loop);
+
+	/// バッファの空きをデコードで埋める関数
+	void fill() noexcept;
+
+	/// 最大frameCountフレームをdstへ読み出す関数
+	///
+	/// 読み出したフレーム数を返す。終端に達した場合のみframeCount未満を返す。
+	/// デコードが間に合わずバッファが空になった場合は、足りない分を無音で埋める。
+	uint32_t read(float *dst, uint32_t frameCount) noexcept;
+};
+
+/// 再生中のOggStreamを定期的に満たすスレッド
+class Streamer {
+private:
+	std::mutex _mutex;
+	std::condition_variable _cv;
+	bool _stop;
+	std::vector<std::weak_ptr<OggStream>> _streams; // 再生し終えて手放されたものは自然に外れる
+	std::thread _thread;
+
+	void _run();
+
+public:
+	Streamer(const Streamer &) = delete;
+	Streamer &operator =(const Streamer &) = delete;
+
+	Streamer();
+	~Streamer();
+
+	void add(const std::shared_ptr<OggStream> &stream);
+};
+
+} // namespace audio
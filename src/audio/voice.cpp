@@ -0,0 +1,88 @@
+#include "voice.hpp"
+
+#include "kernel.hpp"
+
+#include <algorithm>
+
+namespace audio {
+
+constexpr uint64_t PHASE_ONE = 1ull << 32;
+
+void Voice::start(std::shared_ptr<Wave> wave, std::shared_ptr<OggStream> stream, bool loop, int frequency) noexcept {
+	_reader.reset(wave.get(), std::move(stream), loop);
+	_wave = std::move(wave);
+	_current.fill(0.0f);
+	_next.fill(0.0f);
+	_step = (static_cast<uint64_t>(_wave->spec.freq) << 32) / static_cast<uint64_t>(frequency);
+	// NOTE: 最初の出力の前に2フレーム読み進めることで、_currentが先頭フレームとなる。
+	_phase = PHASE_ONE * 2;
+	_playing = true;
+}
+
+void Voice::release() noexcept {
+	_playing = false;
+	_reader.reset(nullptr, nullptr, false);
+	_wave.reset();
+}
+
+void Voice::_mixResampled(float *dst, uint32_t frameCount, int dstChannelCount, MixScratch &scratch) noexcept {
+	const auto channelCount = static_cast<size_t>(_wave->spec.channels);
+	// NOTE: 読み進める入力がscratch.sourceに収まるよう、出力を分けて処理する。
+	const auto maxCount = static_cast<uint32_t>(
+		std::max<uint64_t>((SOURCE_BLOCK_FRAME_COUNT - 2) * PHASE_ONE / _step, 1)
+	);
+	for (uint32_t done = 0; done < frameCount;) {
+		const auto count = std::min(frameCount - done, maxCount);
+		const auto needed = static_cast<uint32_t>(
+			std::min<uint64_t>((_phase + _step * (count - 1)) >> 32, SOURCE_BLOCK_FRAME_COUNT)
+		);
+		const auto read = _reader.read(scratch.source.data(), needed);
+		std::fill(scratch.source.begin() + read * channelCount, scratch.source.begin() + needed * channelCount, 0.0f);
+
+		// 線形補間
+		auto src = scratch.source.data();
+		auto out = scratch.resampled.data();
+		for (uint32_t i = 0; i < count; ++i) {
+			while (_phase >= PHASE_ONE) {
+				std::copy_n(_next.begin(), channelCount, _current.begin());
+				std::copy_n(src, channelCount, _next.begin());
+				src += channelCount;
+				_phase -= PHASE_ONE;
+			}
+			const auto t = static_cast<float>(_phase) * (1.0f / static_cast<float>(PHASE_ONE));
+			for (size_t c = 0; c < channelCount; ++c) {
+				*out++ = _current[c] + (_next[c] - _current[c]) * t;
+			}
+			_phase += _step;
+		}
+
+		accumulateFrames(
+			dst + static_cast<size_t>(done) * static_cast<size_t>(dstChannelCount),
+			dstChannelCount,
+			scratch.resampled.data(),
+			_wave->spec.channels,
+			_wave->order,
+			count,
+			_gain
+		);
+		done += count;
+		if (read < needed) {
+			_playing = false;
+			return;
+		}
+	}
+}
+
+void Voice::mix(float *dst, uint32_t frameCount, int dstChannelCount, MixScratch &scratch) noexcept {
+	if (_step != PHASE_ONE) {
+		_mixResampled(dst, frameCount, dstChannelCount, scratch);
+		return;
+	}
+	const auto read = _reader.read(scratch.source.data(), frameCount);
+	accumulateFrames(dst, dstChannelCount, scratch.source.data(), _wave->spec.channels, _wave->order, read, _gain);
+	if (read < frameCount) {
+		_playing = false;
+	}
+}
+
+} // namespace audio
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "reader.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace audio {
+
+/// 一度に合成する最大フレーム数
+constexpr uint32_t MIX_BLOCK_FRAME_COUNT = 256;
+
+/// リサンプリング時に一度に読み出す最大フレーム数
+constexpr uint32_t SOURCE_BLOCK_FRAME_COUNT = 1024;
+
+/// 合成中の一時データ
+///
+/// 合成はオーディオスレッドで1ボイスずつ行うので、全ボイスで共有する。
+struct MixScratch {
+	std::array<float, SOURCE_BLOCK_FRAME_COUNT * MAX_CHANNEL_COUNT> source;
+	std::array<float, MIX_BLOCK_FRAME_COUNT * MAX_CHANNEL_COUNT> resampled;
+};
+
+/// ミキサーで1つのWaveを再生するボイス
+///
+/// NOTE: mix()はオーディオスレッドから呼ばれるので、それ以外の変更はミキサーをロックして行うこと。
+class Voice {
+private:
+	std::shared_ptr<Wave> _wave;
+	WaveReader _reader;
+	std::array<float, MAX_CHANNEL_COUNT> _current; // 線形補間する2フレーム
+	std::array<float, MAX_CHANNEL_COUNT> _next;
+	uint64_t _step;  // 出力1フレームあたりに進む入力フレーム数 (32.32固定小数点)
+	uint64_t _phase; // _currentから出力位置までの距離 (32.32固定小数点)
+	float _gain;
+	std::atomic<bool> _playing;
+
+	void _mixResampled(float *dst, uint32_t frameCount, int dstChannelCount, MixScratch &scratch) noexcept;
+
+public:
+	Voice(const Voice &) = delete;
+	Voice &operator =(const Voice &) = delete;
+
+	Voice(): _current{}, _next{}, _step(0), _phase(0), _gain(1.0f), _playing(false) {}
+
+	/// 再生中か
+	///
+	/// ロックせずに呼んでも良い。
+	bool playing() const noexcept {
+		return _playing.load(std::memory_order_relaxed);
+	}
+
+	/// 再生しているWave (再生を終えていても次に再生するかrelease()するまで保持し続ける)
+	const std::shared_ptr<Wave> &wave() const noexcept {
+		return _wave;
+	}
+
+	float gain() const noexcept {
+		return _gain;
+	}
+
+	void setGain(float gain) noexcept {
+		_gain = gain;
+	}
+
+	/// waveを先頭から再生し始める関数
+	///
+	/// streamはwaveをストリーミング再生する場合のみ指定する。
+	/// frequencyは合成するサンプリング周波数である。
+	void start(std::shared_ptr<Wave> wave, std::shared_ptr<OggStream> stream, bool loop, int frequency) noexcept;
+
+	/// 再生を止める関数
+	///
+	/// Waveは次に再生するかrelease()するまで保持し続ける。
+	void stop() noexcept {
+		_playing = false;
+	}
+
+	/// 再生を止めてWaveを手放す関数
+	void release() noexcept;
+
+	/// frameCountフレーム分をdstへ加算する関数
+	///
+	/// frameCountはMIX_BLOCK_FRAME_COUNT以下であること。
+	/// オーディオスレッドから呼ばれる。
+	void mix(float *dst, uint32_t frameCount, int dstChannelCount, MixScratch &scratch) noexcept;
+};
+
+} // namespace audio
@@ -2,105 +2,97 @@
 
 #include "../asset/asset.hpp"
 #include "../config/config.hpp"
-#include "_stb_vorbis.h"
-
-#include <charconv>
+#include "adpcm.hpp"
+#include "convert.hpp"
+#include "kernel.hpp"
+#include "ogg.hpp"
+#include "resampler.hpp"
+#include "riff.hpp"
+
+#include <algorithm>
+#include <cstring>
 #include <format>
-#include <string_view>
+#include <vector>
 
 namespace audio {
 
-// NOTE: stb_vorbis.cにerrorというシグネチャが含まれているせいでerror.hppをincludeできないため。
-uint32_t getAssetId(const std::string &s) {
-	if (config::config().assetMap.contains(s)) {
-		return config::config().assetMap.at(s);
-	} else {
-		throw std::out_of_range(std::format("the key '{}' is invalid for assets.", s));
-	}
-}
-
 std::shared_ptr<Wave> createFromWaveFile(const std::string &file, uint32_t startPosition) {
-	const auto assetId = getAssetId(file);
-	const auto data = asset::getAsset(assetId);
+	std::vector<unsigned char> buffer;
+	const auto data = asset::loadAsset(asset::getAssetId(file), buffer);
 
+	// NOTE: 非圧縮PCMとIMA ADPCMであればコピーせずに参照する。IMA ADPCMは再生しながら復号する。
+	//       無圧縮のエントリならアーカイブを、圧縮されたエントリなら展開先のbufferを指すことになる。
+	if (const auto riff = parseRiffWave(data)) {
+		return std::make_shared<Wave>(riff->spec, std::move(buffer), riff->data, startPosition, false, riff->adpcm);
+	}
+
+	// その他の形式はSDLに任せる
 	const auto io = SDL_IOFromConstMem(data.data(), data.size());
 	if (!io) {
 		throw std::format("failed to load '{}'.", file);
 	}
-
 	SDL_AudioSpec spec;
-	Uint8 *buffer;
+	Uint8 *decoded;
 	Uint32 length;
-	if (!SDL_LoadWAV_IO(io, true, &spec, &buffer, &length)) {
+	if (!SDL_LoadWAV_IO(io, true, &spec, &decoded, &length)) {
 		throw std::format("failed to load '{}'.", file);
 	}
-	return std::make_shared<Wave>(spec, buffer, length, startPosition);
+	std::vector<Uint8> storage(decoded, decoded + length);
+	SDL_free(decoded);
+	return std::make_shared<Wave>(spec, std::move(storage), startPosition);
 }
 
 std::shared_ptr<Wave> createFromOggFile(const std::string &file, uint32_t startPosition) {
-	using Vorbis = std::unique_ptr<stb_vorbis, decltype(&stb_vorbis_close)>;
-
-	const auto assetId = getAssetId(file);
-	const auto ogg = asset::getAsset(assetId);
-
-	// NOTE: MSVCの警告を逃れるため。
-	const auto oggSize = static_cast<int>(static_cast<uint32_t>(ogg.size()));
-
-	// ファイルオープン
-	int error;
-	const auto v = Vorbis(stb_vorbis_open_memory(ogg.data(), oggSize, &error, nullptr), stb_vorbis_close);
-	if (!v) {
-		throw std::format("failed to open '{}': {}", file, error);
-	}
-
-	// 情報取得
-	const auto info = stb_vorbis_get_info(v.get());
-	if (info.channels <= 0 || info.sample_rate == 0) {
-		throw std::format("the ogg file '{}' is invalid.", file);
+	std::vector<unsigned char> buffer;
+	const auto ogg = asset::loadAsset(asset::getAssetId(file), buffer);
+	OggDecoder decoder(file, ogg);
+	const auto loopStart = decoder.loopStart(startPosition);
+
+	// NOTE: デコード後のサイズが閾値を超える場合 (BGMなど) は、圧縮されたまま保持して再生しながらデコードする。
+	//       無圧縮のエントリならアーカイブを、圧縮されたエントリなら展開先のbufferを指すことになる。
+	const auto toS16 = config::config().audioDecodeToS16;
+	const auto channelCount = static_cast<uint64_t>(decoder.spec().channels);
+	const auto sampleSize = toS16 ? sizeof(Sint16) : sizeof(float);
+	const auto decodedSize = static_cast<uint64_t>(decoder.frameCount()) * channelCount * sampleSize;
+	if (decodedSize > static_cast<uint64_t>(config::config().audioStreamingThreshold) << 10) {
+		return std::make_shared<Wave>(
+			decoder.spec(),
+			std::move(buffer),
+			ogg,
+			loopStart,
+			true,
+			AdpcmLayout{},
+			ChannelOrder::Vorbis
+		);
 	}
-	const SDL_AudioSpec spec{SDL_AUDIO_F32, info.channels, static_cast<int>(info.sample_rate)};
-
-	// サンプル数取得
-	const auto frameCount = stb_vorbis_stream_length_in_samples(v.get());
-	const auto sampleCount = frameCount * static_cast<unsigned int>(info.channels);
 
 	// デコード
-	auto data = new float[sampleCount];
-	const auto decoded = stb_vorbis_get_samples_float_interleaved(v.get(), info.channels, data, sampleCount);
-	if (decoded < 0 || static_cast<unsigned int>(decoded) != frameCount) {
-		delete[] data;
-		throw std::format("failed to decode '{}'.", file);
+	std::vector<Uint8> storage(decodedSize);
+	if (!toS16) {
+		const auto decoded = decoder.read(reinterpret_cast<float *>(storage.data()), decoder.frameCount());
+		if (decoded != decoder.frameCount()) {
+			throw std::format("failed to decode '{}'.", file);
+		}
+		return std::make_shared<Wave>(decoder.spec(), std::move(storage), loopStart, ChannelOrder::Vorbis);
 	}
 
-	// バイナリデータとして解釈
-	const auto length = static_cast<Uint32>(sampleCount * sizeof(float));
-	auto buffer = reinterpret_cast<Uint8 *>(data);
-
-	// ループ開始位置取得
-	uint32_t startPositionFound = UINT32_MAX;
-	const auto comment = stb_vorbis_get_comment(v.get());
-	for (int i = 0; i < comment.comment_list_length; ++i) {
-		const std::string_view ct(comment.comment_list[i]);
-		if (!ct.starts_with("LOOPSTART=")) {
-			continue;
+	// NOTE: S16で保持する場合は、少しずつ32bit浮動小数点でデコードしてから変換する。
+	constexpr uint32_t blockFrameCount = 4096;
+	std::vector<float> block(blockFrameCount * channelCount);
+	const auto dst = reinterpret_cast<Sint16 *>(storage.data());
+	for (uint32_t done = 0; done < decoder.frameCount();) {
+		const auto decoded = decoder.read(block.data(), std::min(blockFrameCount, decoder.frameCount() - done));
+		if (decoded == 0) {
+			throw std::format("failed to decode '{}'.", file);
 		}
-		const auto ctv = ct.substr(10);
-		size_t lsv;
-		const auto [p, e] = std::from_chars(ctv.data(), ctv.data() + ctv.size(), lsv);
-		if (e == std::errc{}) {
-			startPositionFound = static_cast<uint32_t>(lsv);
-			break;
-		}
-	}
-	if (startPositionFound == UINT32_MAX) {
-		startPositionFound = startPosition;
+		convertFloatToS16(block.data(), dst + done * channelCount, decoded * channelCount);
+		done += decoded;
 	}
-
-	// 終了
-	return std::make_shared<Wave>(spec, buffer, length, startPositionFound);
+	const SDL_AudioSpec spec{SDL_AUDIO_S16, decoder.spec().channels, decoder.spec().freq};
+	return std::make_shared<Wave>(spec, std::move(storage), loopStart, ChannelOrder::Vorbis);
 }
 
-std::shared_ptr<Wave> Wave::fromFile(const std::string &file, uint32_t startPosition) {
+std::shared_ptr<Wave> createFromFile(const std::string &file, uint32_t startPosition) {
 	if (file.ends_with(".wav") || file.ends_with(".wave") || file.ends_with(".WAV") || file.ends_with(".WAVE")) {
 		return createFromWaveFile(file, startPosition);
 	} else if (file.ends_with(".ogg") || file.ends_with(".OGG")) {
@@ -110,4 +102,61 @@ std::shared_ptr<Wave> Wave::fromFile(const std::string &file, uint32_t startPosi
 	}
 }
 
+std::shared_ptr<Wave> Wave::fromFile(const std::string &file, uint32_t startPosition) {
+	auto wave = createFromFile(file, startPosition);
+	if (wave->spec.channels <= 0 || wave->spec.channels > MAX_CHANNEL_COUNT || wave->spec.freq <= 0) {
+		throw std::format("the sound file '{}' has an unsupported spec.", file);
+	}
+	return wave;
+}
+
+std::shared_ptr<Wave> convertWave(
+	std::shared_ptr<Wave> wave,
+	const SDL_AudioSpec &spec,
+	config::ResamplerQuality quality
+) {
+	const auto &src = wave->spec;
+	if (wave->streamed || (src.format == SDL_AUDIO_F32 && src.channels == spec.channels && src.freq == spec.freq)) {
+		return wave;
+	}
+	const auto adpcm = wave->adpcm.blockSize > 0;
+	const auto frameCount = adpcm
+		? static_cast<size_t>(wave->adpcm.frameCount)
+		: wave->data.size() / static_cast<size_t>(SDL_AUDIO_FRAMESIZE(src));
+
+	// 32bit浮動小数点への変換
+	std::vector<float> samples(frameCount * static_cast<size_t>(src.channels));
+	if (adpcm) {
+		AdpcmDecoder decoder;
+		decoder.reset(*wave);
+		decoder.read(samples.data(), static_cast<uint32_t>(frameCount));
+	} else {
+		convertToFloat(wave->data.data(), src.format, samples.data(), samples.size());
+	}
+
+	// チャンネル数の変換
+	if (src.channels != spec.channels) {
+		std::vector<float> mapped(frameCount * static_cast<size_t>(spec.channels));
+		const auto count = static_cast<uint32_t>(frameCount);
+		accumulateFrames(mapped.data(), spec.channels, samples.data(), src.channels, wave->order, count, 1.0f);
+		samples = std::move(mapped);
+	}
+
+	// リサンプリング
+	auto startPosition = wave->startPosition;
+	std::vector<Uint8> storage;
+	if (src.freq == spec.freq) {
+		storage.resize(samples.size() * sizeof(float));
+		std::memcpy(storage.data(), samples.data(), storage.size());
+	} else {
+		const Resampler resampler(src.freq, spec.freq, quality);
+		const auto dstFrameCount = resampler.calcFrameCount(frameCount);
+		storage.resize(dstFrameCount * static_cast<size_t>(spec.channels) * sizeof(float));
+		resampler.process(samples.data(), spec.channels, frameCount, reinterpret_cast<float *>(storage.data()));
+		startPosition = resampler.convertPosition(startPosition);
+	}
+	const SDL_AudioSpec dstSpec{SDL_AUDIO_F32, spec.channels, spec.freq};
+	return std::make_shared<Wave>(dstSpec, std::move(storage), startPosition);
+}
+
 } // namespace audio
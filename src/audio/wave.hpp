@@ -1,46 +1,83 @@
 #pragma once
 
+#include "../config/config.hpp"
+#include "downmix.hpp"
+
 #include <memory>
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_audio.h>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace audio {
 
-inline uint32_t calcLoopStartByte(const SDL_AudioSpec &spec, uint32_t startPosition) {
-	switch (spec.format) {
-	case SDL_AUDIO_U8:
-	case SDL_AUDIO_S8:
-		return startPosition * spec.channels;
-	case SDL_AUDIO_S16LE:
-	case SDL_AUDIO_S16BE:
-		return startPosition * spec.channels * 2;
-	case SDL_AUDIO_S32LE:
-	case SDL_AUDIO_S32BE:
-	case SDL_AUDIO_F32LE:
-	case SDL_AUDIO_F32BE:
-		return startPosition * spec.channels * 4;
-	default:
-		return startPosition * spec.channels;
-	}
-}
+/// 扱える最大チャンネル数 (7.1ch)
+constexpr int MAX_CHANNEL_COUNT = 8;
 
-struct Wave {
-	using Buffer = std::unique_ptr<Uint8, decltype(&SDL_free)>;
+/// IMA ADPCMのデータの配置
+struct AdpcmLayout {
+	uint32_t blockSize;  // ブロックのバイト数 (IMA ADPCMでなければ0)
+	uint32_t frameCount; // 全体のフレーム数
+};
 
+struct Wave {
 	const SDL_AudioSpec spec;
-	const Buffer buffer;
-	const Uint32 length;
-	const uint32_t startByte;
+	const std::vector<Uint8> storage;
+	const std::span<const Uint8> data; // storageの一部またはアーカイブ内のデータを指す
+	const uint32_t startPosition;      // ループ開始位置 (フレーム数)
+	const bool streamed;               // dataが圧縮されたままのOggであり、再生しながらデコードするか
+	const AdpcmLayout adpcm;           // dataがIMA ADPCMの場合の配置 (specは復号後のS16を表す)
+	const ChannelOrder order;          // チャンネルの並び (Oggから作ったものはVorbisの並び)
+	uint64_t decodeTime = 0;           // 読込み時のデコードに要した時間 (ナノ秒)
 
-	Wave(const SDL_AudioSpec &spec, Uint8 *buffer, Uint32 length, uint32_t startPosition):
+	Wave(
+		const SDL_AudioSpec &spec,
+		std::vector<Uint8> &&storage,
+		std::span<const Uint8> data,
+		uint32_t startPosition,
+		bool streamed = false,
+		const AdpcmLayout &adpcm = {},
+		ChannelOrder order = ChannelOrder::Sdl
+	):
 		spec(spec),
-		buffer(Buffer(buffer, SDL_free)),
-		length(length),
-		startByte(calcLoopStartByte(spec, startPosition))
+		storage(std::move(storage)),
+		data(data),
+		startPosition(startPosition),
+		streamed(streamed),
+		adpcm(adpcm),
+		order(order)
 	{}
 
+	Wave(
+		const SDL_AudioSpec &spec,
+		std::vector<Uint8> &&storage,
+		uint32_t startPosition,
+		ChannelOrder order = ChannelOrder::Sdl
+	):
+		spec(spec),
+		storage(std::move(storage)),
+		data(this->storage),
+		startPosition(startPosition),
+		streamed(false),
+		adpcm{},
+		order(order)
+	{}
+
+	/// アセットからWAVEを作成する関数
+	///
+	/// スレッドセーフであり、ワーカースレッドから呼んでも良い。
 	static std::shared_ptr<Wave> fromFile(const std::string &file, uint32_t startPosition);
 };
 
+/// WAVEをチャンネル数・サンプリング周波数がspecの32bit浮動小数点へ変換する関数
+///
+/// ストリーミング再生するものや既にspecと同じ形式のものはそのまま返す。
+/// スレッドセーフであり、ワーカースレッドから呼んでも良い。
+std::shared_ptr<Wave> convertWave(
+	std::shared_ptr<Wave> wave,
+	const SDL_AudioSpec &spec,
+	config::ResamplerQuality quality
+);
+
 } // namespace audio
@@ -18,14 +18,14 @@ Format parseFormat(const std::string& s) {
 		: throw std::format("config error: format '{}' is invalid.", s);
 }
 
-ClearValueConfig parseClearValueConfig(const YAML::Node &node) {
-	const bool isColor = node["clear-value"] && node["clear-value"].IsSequence();
+ClearValueConfig parseClearValueConfig(const Node &node) {
+	const bool isColor = node["clear-value"] && node["clear-value"].isSequence();
 	return isColor
 		? ClearValueConfig(get<std::array<float, 4>>(node, "clear-value", "float[4]"))
 		: ClearValueConfig(f(node, "clear-value"));
 }
 
-AttachmentConfig::AttachmentConfig(const YAML::Node &node):
+AttachmentConfig::AttachmentConfig(const Node &node):
 	format(parseFormat(s(node, "format"))),
 	discard(b(node, "discard", false)),
 	clearValue(parseClearValueConfig(node))
@@ -33,7 +33,7 @@ AttachmentConfig::AttachmentConfig(const YAML::Node &node):
 	checkUnexpectedKeys(node, {"id", "format", "discard", "clear-value"});
 }
 
-std::unordered_map<std::string, AttachmentConfig> parseAttachmentConfigs(const YAML::Node &node) {
+std::unordered_map<std::string, AttachmentConfig> parseAttachmentConfigs(const Node &node) {
 	std::unordered_map<std::string, AttachmentConfig> attachments;
 	for (const auto &n: node["attachments"]) {
 		const auto id = s(n, "id");
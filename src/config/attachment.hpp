@@ -1,7 +1,8 @@
 #pragma once
 
-#include <yaml-cpp/yaml.h>
+#include "node.hpp"
 
+#include <unordered_map>
 #include <variant>
 
 namespace config {
@@ -22,9 +23,9 @@ struct AttachmentConfig {
 	const bool discard;
 	const ClearValueConfig clearValue;
 
-	AttachmentConfig(const YAML::Node &node);
+	AttachmentConfig(const Node &node);
 };
 
-std::unordered_map<std::string, AttachmentConfig> parseAttachmentConfigs(const YAML::Node &node);
+std::unordered_map<std::string, AttachmentConfig> parseAttachmentConfigs(const Node &node);
 
 } // namespace config
@@ -18,28 +18,28 @@ inline ComputeDescriptorType parseComputeDescriptorType(const std::string& s) {
 		: throw std::format("config error: type '{}' is invalid.", s);
 }
 
-ComputeDescriptorBindingConfig::ComputeDescriptorBindingConfig(const YAML::Node &node):
+ComputeDescriptorBindingConfig::ComputeDescriptorBindingConfig(const Node &node):
 	type(parseComputeDescriptorType(s(node, "type"))),
 	count(u(node, "count", 1))
 {
 	checkUnexpectedKeys(node, {"type", "count"});
 }
 
-ComputeDescriptorSetConfig::ComputeDescriptorSetConfig(const YAML::Node &node):
+ComputeDescriptorSetConfig::ComputeDescriptorSetConfig(const Node &node):
 	count(u(node, "count")),
 	bindings(parseConfigs<ComputeDescriptorBindingConfig>(node, "bindings"))
 {
 	checkUnexpectedKeys(node, {"count", "bindings"});
 }
 
-ComputePipelineConfig::ComputePipelineConfig(const YAML::Node &node):
+ComputePipelineConfig::ComputePipelineConfig(const Node &node):
 	shader(s(node, "shader")),
 	descSets(parseConfigs<ComputeDescriptorSetConfig>(node, "desc-sets"))
 {
 	checkUnexpectedKeys(node, {"id", "shader", "desc-sets"});
 }
 
-std::unordered_map<std::string, ComputePipelineConfig> parseComputePipelineConfigs(const YAML::Node &node) {
+std::unordered_map<std::string, ComputePipelineConfig> parseComputePipelineConfigs(const Node &node) {
 	std::unordered_map<std::string, ComputePipelineConfig> pipelines;
 	for (const auto &n: node["compute-pipelines"]) {
 		const auto id = s(n, "id");
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <yaml-cpp/yaml.h>
+#include "node.hpp"
+
+#include <unordered_map>
 
 namespace config {
 
@@ -16,23 +18,23 @@ struct ComputeDescriptorBindingConfig {
 	const ComputeDescriptorType type;
 	const uint32_t count;
 
-	ComputeDescriptorBindingConfig(const YAML::Node &node);
+	ComputeDescriptorBindingConfig(const Node &node);
 };
 
 struct ComputeDescriptorSetConfig {
 	const uint32_t count;
 	const std::vector<ComputeDescriptorBindingConfig> bindings;
 
-	ComputeDescriptorSetConfig(const YAML::Node &node);
+	ComputeDescriptorSetConfig(const Node &node);
 };
 
 struct ComputePipelineConfig {
 	const std::string shader;
 	const std::vector<ComputeDescriptorSetConfig> descSets;
 
-	ComputePipelineConfig(const YAML::Node &node);
+	ComputePipelineConfig(const Node &node);
 };
 
-std::unordered_map<std::string, ComputePipelineConfig> parseComputePipelineConfigs(const YAML::Node &node);
+std::unordered_map<std::string, ComputePipelineConfig> parseComputePipelineConfigs(const Node &node);
 
 } // namespace config
@@ -0,0 +1,38 @@
+#include "config.hpp"
+
+#include "../asset/asset.hpp"
+
+#include <configcompiler.hpp>
+#include <optional>
+#include <yaml-cpp/yaml.h>
+
+namespace config {
+
+std::optional<Config> g_config;
+
+void initialize() {
+	// NOTE: assetzipで変換されていないconfig (開発時など) はここで変換する。
+	//       アーカイブ内で4バイト境界に配置されていなければ複製して参照する。
+	auto data = asset::getConfigData();
+	std::vector<unsigned char> blob;
+	if (!isConfigBlob(data)) {
+		const auto yaml = std::string(reinterpret_cast<const char *>(data.data()), data.size());
+		blob = ConfigCompiler().compile(YAML::Load(yaml));
+		data = blob;
+	} else if (reinterpret_cast<uintptr_t>(data.data()) % alignof(ConfigNode) != 0) {
+		blob.assign(data.begin(), data.end());
+		data = blob;
+	}
+	const Document document(data);
+	g_config.emplace(Node(document, 0));
+}
+
+const Config &config() {
+	if (g_config.has_value()) {
+		return g_config.value();
+	} else {
+		throw "config not initialized.";
+	}
+}
+
+} // namespace config
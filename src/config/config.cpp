@@ -1,34 +1,9 @@
 #include "config.hpp"
 
-#include "../asset/asset.hpp"
 #include "utils.hpp"
 
 namespace config {
 
-std::optional<Config> g_config;
-
-std::unordered_map<std::string, uint32_t> collectAssetMap(const YAML::Node &node) {
-	if (!node["assets"]) {
-		return {};
-	}
-	if (!node["assets"].IsSequence()) {
-		throw "config error: assets must be a string sequence.";
-	}
-
-	const auto assets = ss(node, "assets");
-
-	std::unordered_map<std::string, uint32_t> assetMap;
-	for (const auto &n: assets) {
-		if (assetMap.contains(n)) {
-			throw std::format("config error: asset '{}' is duplicated.", n);
-		}
-		const auto size = assetMap.size();
-		assetMap.emplace(n, static_cast<uint32_t>(size));
-	}
-
-	return assetMap;
-}
-
 // NOTE: 文字アトラスの順番は実行時に決めて良い。
 std::unordered_map<std::string, uint32_t> collectFontMap(const std::unordered_map<std::string, FontConfig> &fonts) {
 	std::unordered_map<std::string, uint32_t> fontMap;
@@ -41,7 +16,17 @@ std::unordered_map<std::string, uint32_t> collectFontMap(const std::unordered_ma
 	return fontMap;
 }
 
-Config::Config(const YAML::Node &node):
+ResamplerQuality parseResamplerQuality(const std::string &s) {
+	return s == "low"
+		? ResamplerQuality::Low
+		: s == "medium"
+		? ResamplerQuality::Medium
+		: s == "high"
+		? ResamplerQuality::High
+		: throw std::format("config error: audio-resampler-quality '{}' is invalid.", s);
+}
+
+Config::Config(const Node &node):
 	title(s(node, "title")),
 	width(u(node, "width")),
 	height(u(node, "height")),
@@ -49,14 +34,24 @@ Config::Config(const YAML::Node &node):
 	disableVsync(b(node, "disable-vsync", false)),
 	altReturnToggleFullscreen(b(node, "alt-return-toggle-fullscreen", true)),
 	audioChannelCount(u(node, "audio-channel-count", 16)),
+	audioSoundCount(u(node, "audio-sound-count", 128)),
+	audioStreamingThreshold(u(node, "audio-streaming-threshold", 1024)),
+	audioDecodeToS16(b(node, "audio-decode-to-s16", false)),
+	audioConvertOnLoad(b(node, "audio-convert-on-load", false)),
+	audioResamplerQuality(parseResamplerQuality(s(node, "audio-resampler-quality", "medium"))),
+	audioMemoryBudget(u(node, "audio-memory-budget", 0)),
+	audioStatisticsLogInterval(u(node, "audio-statistics-log-interval", 0)),
 	charCount(u(node, "char-count", 256)),
+	assetCacheSize(u(node, "asset-cache-size", 64)),
+	asyncUploadBudget(u(node, "async-upload-budget", 8192)),
+	eagerAssetVerification(b(node, "eager-asset-verification", false)),
+	assetTrace(s(node, "asset-trace", "")),
 	meshes(parseMeshConfigs(node)),
 	fonts(parseFontConfigs(node)),
 	attachments(parseAttachmentConfigs(node)),
 	pipelines(parsePipelineConfigs(node)),
 	renderPasses(parseRenderPassConfigs(node)),
 	computePipelines(parseComputePipelineConfigs(node)),
-	assetMap(collectAssetMap(node)),
 	fontMap(collectFontMap(fonts))
 {
 	checkUnexpectedKeys(
@@ -69,7 +64,18 @@ Config::Config(const YAML::Node &node):
 			"disable-vsync",
 			"alt-return-toggle-fullscreen",
 			"audio-channel-count",
+			"audio-sound-count",
+			"audio-streaming-threshold",
+			"audio-decode-to-s16",
+			"audio-convert-on-load",
+			"audio-resampler-quality",
+			"audio-memory-budget",
+			"audio-statistics-log-interval",
 			"char-count",
+			"asset-cache-size",
+			"async-upload-budget",
+			"eager-asset-verification",
+			"asset-trace",
 			"assets",
 			"meshes",
 			"fonts",
@@ -120,18 +126,4 @@ Config::Config(const YAML::Node &node):
 	}
 }
 
-void initialize() {
-	const auto data = asset::getConfigData();
-	const auto yaml = std::string(reinterpret_cast<const char *>(data.data()), data.size());
-	g_config.emplace(YAML::Load(yaml));
-}
-
-const Config &config() {
-	if (g_config.has_value()) {
-		return g_config.value();
-	} else {
-		throw "config not initialized.";
-	}
-}
-
 } // namespace config
@@ -9,6 +9,12 @@
 
 namespace config {
 
+enum class ResamplerQuality: uint8_t {
+	Low,
+	Medium,
+	High,
+};
+
 struct Config {
 	const std::string title;
 	const uint32_t width;
@@ -17,7 +23,18 @@ struct Config {
 	const bool disableVsync;
 	const bool altReturnToggleFullscreen;
 	const uint32_t audioChannelCount;
+	const uint32_t audioSoundCount;
+	const uint32_t audioStreamingThreshold;
+	const bool audioDecodeToS16;
+	const bool audioConvertOnLoad;
+	const ResamplerQuality audioResamplerQuality;
+	const uint32_t audioMemoryBudget;
+	const uint32_t audioStatisticsLogInterval;
 	const uint32_t charCount;
+	const uint32_t assetCacheSize;
+	const uint32_t asyncUploadBudget;
+	const bool eagerAssetVerification;
+	const std::string assetTrace;
 	const std::unordered_map<std::string, MeshConfig> meshes;
 	const std::unordered_map<std::string, FontConfig> fonts;
 	const std::unordered_map<std::string, AttachmentConfig> attachments;
@@ -25,10 +42,10 @@ struct Config {
 	const std::unordered_map<std::string, RenderPassConfig> renderPasses;
 	const std::unordered_map<std::string, ComputePipelineConfig> computePipelines;
 
-	const std::unordered_map<std::string, uint32_t> assetMap;
 	const std::unordered_map<std::string, uint32_t> fontMap;
 
-	Config(const YAML::Node &node);
+	/// NOTE: assetzipも変換時の検証に用いるので、アセットなど実行時の状態に依存しないこと。
+	Config(const Node &node);
 };
 
 void initialize();
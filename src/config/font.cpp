@@ -4,7 +4,7 @@
 
 namespace config {
 
-FontConfig::FontConfig(const YAML::Node &node):
+FontConfig::FontConfig(const Node &node):
 	file(s(node, "file")),
 	charSize(u(node, "char-size")),
 	charAtlusCol(u(node, "char-atlus-col")),
@@ -23,7 +23,7 @@ FontConfig::FontConfig(const YAML::Node &node):
 	}
 }
 
-std::unordered_map<std::string, FontConfig> parseFontConfigs(const YAML::Node &node) {
+std::unordered_map<std::string, FontConfig> parseFontConfigs(const Node &node) {
 	std::unordered_map<std::string, FontConfig> fonts;
 	for (const auto &n: node["fonts"]) {
 		const auto id = s(n, "id");
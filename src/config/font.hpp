@@ -1,6 +1,8 @@
 #pragma once
 
-#include <yaml-cpp/yaml.h>
+#include "node.hpp"
+
+#include <unordered_map>
 
 namespace config {
 
@@ -10,9 +12,9 @@ struct FontConfig {
 	const uint32_t charAtlusCol;
 	const uint32_t charAtlusRow;
 
-	FontConfig(const YAML::Node &node);
+	FontConfig(const Node &node);
 };
 
-std::unordered_map<std::string, FontConfig> parseFontConfigs(const YAML::Node &node);
+std::unordered_map<std::string, FontConfig> parseFontConfigs(const Node &node);
 
 } // namespace config
@@ -4,11 +4,11 @@
 
 namespace config {
 
-MeshConfig::MeshConfig(const YAML::Node &node): vertices(s(node, "vertices")), indices(s(node, "indices")) {
+MeshConfig::MeshConfig(const Node &node): vertices(s(node, "vertices")), indices(s(node, "indices")) {
 	checkUnexpectedKeys(node, {"id", "vertices", "indices"});
 }
 
-std::unordered_map<std::string, MeshConfig> parseMeshConfigs(const YAML::Node &node) {
+std::unordered_map<std::string, MeshConfig> parseMeshConfigs(const Node &node) {
 	std::unordered_map<std::string, MeshConfig> meshes;
 	for (const auto &n: node["meshes"]) {
 		const auto id = s(n, "id");
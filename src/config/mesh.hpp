@@ -1,7 +1,8 @@
 #pragma once
 
+#include "node.hpp"
+
 #include <unordered_map>
-#include <yaml-cpp/yaml.h>
 
 namespace config {
 
@@ -9,9 +10,9 @@ struct MeshConfig {
 	const std::string vertices;
 	const std::string indices;
 
-	MeshConfig(const YAML::Node &node);
+	MeshConfig(const Node &node);
 };
 
-std::unordered_map<std::string, MeshConfig> parseMeshConfigs(const YAML::Node &node);
+std::unordered_map<std::string, MeshConfig> parseMeshConfigs(const Node &node);
 
 } // namespace config
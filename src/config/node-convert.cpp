@@ -0,0 +1,94 @@
+#include "node.hpp"
+
+namespace config {
+
+// NOTE: 以下の変換はyaml-cppの挙動に合わせている (スカラーの解釈はconfigscalar.hppを参照)。
+template<>
+std::string Node::as<std::string>() const {
+	if (!_document) {
+		throw "not a string";
+	}
+	const auto &n = _document->node(_index);
+	switch (n.type) {
+	case ConfigNodeType::Null:
+		return "null";
+	case ConfigNodeType::Scalar:
+		return std::string(_document->scalar(n));
+	default:
+		throw "not a string";
+	}
+}
+
+// NOTE: スカラーの解釈は変換時に済んでいるので、ここでは解釈できたかを確かめて値を取り出すだけである。
+const ConfigNode *scalarOf(const Document *document, uint32_t index, uint32_t kind) noexcept {
+	if (!document) {
+		return nullptr;
+	}
+	const auto &n = document->node(index);
+	return n.type == ConfigNodeType::Scalar && (n.kinds & kind) != 0 ? &n : nullptr;
+}
+
+template<>
+bool Node::as<bool>() const {
+	const auto n = scalarOf(_document, _index, CONFIG_SCALAR_BOOL);
+	if (!n) {
+		throw "not a bool";
+	}
+	return n->value != 0;
+}
+
+template<>
+uint32_t Node::as<uint32_t>() const {
+	const auto n = scalarOf(_document, _index, CONFIG_SCALAR_UINT);
+	if (!n) {
+		throw "not an unsigned int";
+	}
+	return n->value;
+}
+
+template<>
+float Node::as<float>() const {
+	const auto n = scalarOf(_document, _index, CONFIG_SCALAR_FLOAT);
+	if (!n) {
+		throw "not a float";
+	}
+	return n->real;
+}
+
+template<typename T>
+std::vector<T> asVector(const Node &node) {
+	if (!node.isSequence()) {
+		throw "not a sequence";
+	}
+	std::vector<T> values;
+	for (const auto &n: node) {
+		values.push_back(n.as<T>());
+	}
+	return values;
+}
+
+template<>
+std::vector<bool> Node::as<std::vector<bool>>() const {
+	return asVector<bool>(*this);
+}
+
+template<>
+std::vector<uint32_t> Node::as<std::vector<uint32_t>>() const {
+	return asVector<uint32_t>(*this);
+}
+
+template<>
+std::vector<std::string> Node::as<std::vector<std::string>>() const {
+	return asVector<std::string>(*this);
+}
+
+template<>
+std::array<float, 4> Node::as<std::array<float, 4>>() const {
+	const auto values = asVector<float>(*this);
+	if (values.size() != 4) {
+		throw "not a float[4]";
+	}
+	return {values[0], values[1], values[2], values[3]};
+}
+
+} // namespace config
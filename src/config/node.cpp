@@ -0,0 +1,94 @@
+#include "node.hpp"
+
+#include <cstring>
+
+namespace config {
+
+bool isConfigBlob(std::span<const unsigned char> data) noexcept {
+	uint32_t magic = 0;
+	if (data.size() >= sizeof(ConfigBlobHeader)) {
+		std::memcpy(&magic, data.data(), sizeof(magic));
+	}
+	return magic == CONFIG_BLOB_MAGIC;
+}
+
+Document::Document(std::span<const unsigned char> data) {
+	ConfigBlobHeader header;
+	if (data.size() < sizeof(ConfigBlobHeader)) {
+		throw "config error: the config blob is broken.";
+	}
+	std::memcpy(&header, data.data(), sizeof(ConfigBlobHeader));
+	if (header.magic != CONFIG_BLOB_MAGIC || header.version != CONFIG_BLOB_VERSION) {
+		throw "config error: the config blob is incompatible.";
+	}
+	const auto nodesSize = sizeof(ConfigNode) * static_cast<uint64_t>(header.nodeCount);
+	const auto childrenSize = sizeof(uint32_t) * static_cast<uint64_t>(header.childCount);
+	if (header.nodeCount == 0 || data.size() - sizeof(ConfigBlobHeader) < nodesSize + childrenSize + header.stringSize) {
+		throw "config error: the config blob is broken.";
+	}
+	// NOTE: 4バイト境界に配置されていることは呼出し側が保証する。
+	const auto p = data.data() + sizeof(ConfigBlobHeader);
+	_nodes = reinterpret_cast<const ConfigNode *>(p);
+	_children = reinterpret_cast<const uint32_t *>(p + nodesSize);
+	_strings = reinterpret_cast<const char *>(p + nodesSize + childrenSize);
+
+	for (uint32_t i = 0; i < header.nodeCount; ++i) {
+		const auto &n = _nodes[i];
+		const auto count = static_cast<uint64_t>(n.count);
+		const auto valid = n.type == ConfigNodeType::Null
+			|| (n.type == ConfigNodeType::Scalar && n.first + count <= header.stringSize)
+			|| (n.type == ConfigNodeType::Sequence && n.first + count <= header.childCount)
+			|| (n.type == ConfigNodeType::Map && n.first + count * 2 <= header.childCount);
+		if (!valid) {
+			throw "config error: the config blob is broken.";
+		}
+	}
+	for (uint32_t i = 0; i < header.childCount; ++i) {
+		if (_children[i] >= header.nodeCount) {
+			throw "config error: the config blob is broken.";
+		}
+	}
+}
+
+Node Node::operator [](std::string_view key) const noexcept {
+	if (!_document) {
+		return Node();
+	}
+	const auto &n = _document->node(_index);
+	if (n.type != ConfigNodeType::Map) {
+		return Node();
+	}
+	for (uint32_t i = 0; i < n.count; ++i) {
+		const auto &k = _document->node(_document->child(n.first + i * 2));
+		if (k.type == ConfigNodeType::Scalar && _document->scalar(k) == key) {
+			return Node(*_document, _document->child(n.first + i * 2 + 1));
+		}
+	}
+	return Node();
+}
+
+NodeIterator Node::begin() const noexcept {
+	if (!_document) {
+		return NodeIterator(nullptr, ConfigNode{ConfigNodeType::Null, 0, 0, 0, 0, 0.0f}, 0);
+	}
+	return NodeIterator(_document, _document->node(_index), 0);
+}
+
+NodeIterator Node::end() const noexcept {
+	if (!_document) {
+		return NodeIterator(nullptr, ConfigNode{ConfigNodeType::Null, 0, 0, 0, 0, 0.0f}, 0);
+	}
+	const auto &n = _document->node(_index);
+	const auto count = n.type == ConfigNodeType::Sequence || n.type == ConfigNodeType::Map ? n.count : 0;
+	return NodeIterator(_document, n, count);
+}
+
+NodeEntry NodeIterator::operator *() const noexcept {
+	if (_node.type == ConfigNodeType::Map) {
+		const auto i = _node.first + _position * 2;
+		return NodeEntry{Node(), Node(*_document, _document->child(i)), Node(*_document, _document->child(i + 1))};
+	}
+	return NodeEntry{Node(*_document, _document->child(_node.first + _position)), Node(), Node()};
+}
+
+} // namespace config
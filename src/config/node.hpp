@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <configdef.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace config {
+
+/// configのバイナリ表現を検証し、その内容を参照するためのクラス
+///
+/// 参照するデータの寿命は呼出し側が保証すること。
+class Document {
+private:
+	const ConfigNode *_nodes;
+	const uint32_t *_children;
+	const char *_strings;
+
+public:
+	Document() = delete;
+	Document(const Document &) = delete;
+	Document &operator =(const Document &) = delete;
+
+	/// NOTE: 全ノードの範囲をここで検証するので、以降の参照では検証しない。
+	Document(std::span<const unsigned char> data);
+
+	const ConfigNode &node(uint32_t index) const noexcept {
+		return _nodes[index];
+	}
+
+	uint32_t child(uint32_t index) const noexcept {
+		return _children[index];
+	}
+
+	std::string_view scalar(const ConfigNode &node) const noexcept {
+		return std::string_view(_strings + node.first, node.count);
+	}
+};
+
+bool isConfigBlob(std::span<const unsigned char> data) noexcept;
+
+class NodeIterator;
+
+/// configの解析に用いるノード
+///
+/// YAML::Nodeのうちconfigの解析に必要な部分だけを模している。
+/// 存在しないキーを引いた場合は、偽と評価される空のノードが返る。
+class Node {
+private:
+	const Document *_document;
+	uint32_t _index;
+
+public:
+	Node(): _document(nullptr), _index(0) {}
+	Node(const Document &document, uint32_t index): _document(&document), _index(index) {}
+
+	explicit operator bool() const noexcept {
+		return _document != nullptr;
+	}
+
+	bool isSequence() const noexcept {
+		return _document && _document->node(_index).type == ConfigNodeType::Sequence;
+	}
+
+	Node operator [](std::string_view key) const noexcept;
+
+	/// スカラーあるいは配列を値として取得する関数
+	///
+	/// 変換できない場合は例外が発生する。
+	template<typename T>
+	T as() const;
+
+	/// NOTE: 配列なら各要素を、マップならキーと値の組 (first, second) を列挙する。
+	NodeIterator begin() const noexcept;
+	NodeIterator end() const noexcept;
+};
+
+template<> bool Node::as<bool>() const;
+template<> float Node::as<float>() const;
+template<> uint32_t Node::as<uint32_t>() const;
+template<> std::string Node::as<std::string>() const;
+template<> std::vector<bool> Node::as<std::vector<bool>>() const;
+template<> std::vector<uint32_t> Node::as<std::vector<uint32_t>>() const;
+template<> std::vector<std::string> Node::as<std::vector<std::string>>() const;
+template<> std::array<float, 4> Node::as<std::array<float, 4>>() const;
+
+struct NodeEntry: Node {
+	Node first;
+	Node second;
+};
+
+class NodeIterator {
+private:
+	const Document *_document;
+	ConfigNode _node;
+	uint32_t _position;
+
+public:
+	NodeIterator(const Document *document, const ConfigNode &node, uint32_t position):
+		_document(document),
+		_node(node),
+		_position(position)
+	{}
+
+	NodeEntry operator *() const noexcept;
+
+	NodeIterator &operator ++() noexcept {
+		_position += 1;
+		return *this;
+	}
+
+	bool operator !=(const NodeIterator &other) const noexcept {
+		return _position != other._position;
+	}
+};
+
+} // namespace config
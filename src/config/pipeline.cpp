@@ -28,7 +28,7 @@ inline ShaderStages parseShaderStages(const std::string& s) {
 		: throw std::format("config error: stages '{}' is invalid.", s);
 }
 
-DescriptorBindingConfig::DescriptorBindingConfig(const YAML::Node &node):
+DescriptorBindingConfig::DescriptorBindingConfig(const Node &node):
 	type(parseDescriptorType(s(node, "type"))),
 	count(u(node, "count", 1)),
 	stage(parseShaderStages(s(node, "stage")))
@@ -36,14 +36,14 @@ DescriptorBindingConfig::DescriptorBindingConfig(const YAML::Node &node):
 	checkUnexpectedKeys(node, {"type", "count", "stage"});
 }
 
-DescriptorSetConfig::DescriptorSetConfig(const YAML::Node &node):
+DescriptorSetConfig::DescriptorSetConfig(const Node &node):
 	count(u(node, "count")),
 	bindings(parseConfigs<DescriptorBindingConfig>(node, "bindings"))
 {
 	checkUnexpectedKeys(node, {"count", "bindings"});
 }
 
-PipelineConfig::PipelineConfig(const YAML::Node &node):
+PipelineConfig::PipelineConfig(const Node &node):
 	vertexShader(s(node, "vertex-shader")),
 	fragmentShader(s(node, "fragment-shader")),
 	descSets(parseConfigs<DescriptorSetConfig>(node, "desc-sets")),
@@ -66,7 +66,7 @@ PipelineConfig::PipelineConfig(const YAML::Node &node):
 	}
 }
 
-std::unordered_map<std::string, PipelineConfig> parsePipelineConfigs(const YAML::Node &node) {
+std::unordered_map<std::string, PipelineConfig> parsePipelineConfigs(const Node &node) {
 	std::unordered_map<std::string, PipelineConfig> pipelines;
 	for (const auto &n: node["pipelines"]) {
 		const auto id = s(n, "id");
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <yaml-cpp/yaml.h>
+#include "node.hpp"
+
+#include <unordered_map>
 
 namespace config {
 
@@ -23,7 +25,7 @@ struct DescriptorBindingConfig {
 	const uint32_t count;
 	const ShaderStages stage;
 
-	DescriptorBindingConfig(const YAML::Node &node);
+	DescriptorBindingConfig(const Node &node);
 	DescriptorBindingConfig(DescriptorType type, uint32_t count, ShaderStages stage):
 		type(type), count(count), stage(stage)
 	{}
@@ -33,7 +35,7 @@ struct DescriptorSetConfig {
 	const uint32_t count;
 	const std::vector<DescriptorBindingConfig> bindings;
 
-	DescriptorSetConfig(const YAML::Node &node);
+	DescriptorSetConfig(const Node &node);
 	DescriptorSetConfig(uint32_t count, const std::vector<DescriptorBindingConfig> &&bindings):
 		count(count), bindings(bindings)
 	{}
@@ -49,9 +51,9 @@ struct PipelineConfig {
 	const bool depthTest;
 	const std::vector<bool> colorBlends;
 
-	PipelineConfig(const YAML::Node &node);
+	PipelineConfig(const Node &node);
 };
 
-std::unordered_map<std::string, PipelineConfig> parsePipelineConfigs(const YAML::Node &node);
+std::unordered_map<std::string, PipelineConfig> parsePipelineConfigs(const Node &node);
 
 } // namespace config
@@ -4,11 +4,11 @@
 
 namespace config {
 
-SubpassDepthConfig::SubpassDepthConfig(const YAML::Node &node): id(s(node, "id")), readOnly(b(node, "read-only")) {
+SubpassDepthConfig::SubpassDepthConfig(const Node &node): id(s(node, "id")), readOnly(b(node, "read-only")) {
 	checkUnexpectedKeys(node, {"id", "read-only"});
 }
 
-SubpassConfig::SubpassConfig(const YAML::Node &node):
+SubpassConfig::SubpassConfig(const Node &node):
 	id(s(node, "id")),
 	inputs(sus(node, "inputs", std::make_optional<std::unordered_set<std::string>>({}))),
 	outputs(sus(node, "outputs")),
@@ -38,7 +38,7 @@ std::vector<std::string> collectAttachments(const std::vector<SubpassConfig> &su
 	return result;
 }
 
-RenderPassConfig::RenderPassConfig(const YAML::Node &node):
+RenderPassConfig::RenderPassConfig(const Node &node):
 	subpasses(parseConfigs<SubpassConfig>(node, "subpasses")),
 	attachments(collectAttachments(subpasses)),
 	attachmentMap(collectMap(attachments)),
@@ -56,7 +56,7 @@ RenderPassConfig::RenderPassConfig(const YAML::Node &node):
 	}
 }
 
-std::unordered_map<std::string, RenderPassConfig> parseRenderPassConfigs(const YAML::Node &node) {
+std::unordered_map<std::string, RenderPassConfig> parseRenderPassConfigs(const Node &node) {
 	std::unordered_map<std::string, RenderPassConfig> renderPasses;
 	for (const auto &n: node["render-passes"]) {
 		const auto id = s(n, "id");
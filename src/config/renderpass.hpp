@@ -1,8 +1,10 @@
 #pragma once
 
+#include "node.hpp"
+
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
-#include <yaml-cpp/yaml.h>
 
 namespace config {
 
@@ -10,7 +12,7 @@ struct SubpassDepthConfig {
 	const std::string id;
 	const bool readOnly;
 
-	SubpassDepthConfig(const YAML::Node &node);
+	SubpassDepthConfig(const Node &node);
 };
 
 struct SubpassConfig {
@@ -21,7 +23,7 @@ struct SubpassConfig {
 	const std::unordered_set<std::string> depends;
 	const std::unordered_set<std::string> pipelines;
 
-	SubpassConfig(const YAML::Node &node);
+	SubpassConfig(const Node &node);
 };
 
 struct RenderPassConfig {
@@ -31,9 +33,9 @@ struct RenderPassConfig {
 	const std::unordered_map<std::string, uint32_t> attachmentMap;
 	const std::unordered_map<std::string, uint32_t> subpassMap;
 
-	RenderPassConfig(const YAML::Node &node);
+	RenderPassConfig(const Node &node);
 };
 
-std::unordered_map<std::string, RenderPassConfig> parseRenderPassConfigs(const YAML::Node &node);
+std::unordered_map<std::string, RenderPassConfig> parseRenderPassConfigs(const Node &node);
 
 } // namespace config
@@ -1,13 +1,16 @@
 #pragma once
 
+#include "node.hpp"
+
 #include <format>
-#include <unordered_set>
 #include <optional>
-#include <yaml-cpp/yaml.h>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace config {
 
-inline void checkUnexpectedKeys(const YAML::Node &n, const std::set<std::string> &ks) {
+inline void checkUnexpectedKeys(const Node &n, const std::set<std::string> &ks) {
 	for (const auto &p: n) {
 		const auto k = p.first.as<std::string>();
 		if (!ks.contains(k)) {
@@ -24,7 +27,7 @@ void validateValue(const T &v, const std::set<T> &cs, const std::string &s) {
 }
 
 template<typename T>
-T get(const YAML::Node &n, const std::string &k, const std::string &t, std::optional<T> d = std::nullopt) {
+T get(const Node &n, const std::string &k, const std::string &t, std::optional<T> d = std::nullopt) {
 	if (!n[k]) {
 		if (d) {
 			return d.value();
@@ -39,28 +42,28 @@ T get(const YAML::Node &n, const std::string &k, const std::string &t, std::opti
 	}
 }
 
-inline bool b(const YAML::Node &n, const std::string &k, std::optional<bool> d = std::nullopt) {
+inline bool b(const Node &n, const std::string &k, std::optional<bool> d = std::nullopt) {
 	return get<bool>(n, k, "bool", d);
 }
 
-inline float f(const YAML::Node &n, const std::string &k) {
+inline float f(const Node &n, const std::string &k) {
 	return get<float>(n, k, "float");
 }
 
-inline uint32_t u(const YAML::Node &n, const std::string &k, std::optional<uint32_t> d = std::nullopt) {
+inline uint32_t u(const Node &n, const std::string &k, std::optional<uint32_t> d = std::nullopt) {
 	return get<uint32_t>(n, k, "unsigned int", d);
 }
 
-inline std::string s(const YAML::Node &n, const std::string &k, std::optional<std::string> d = std::nullopt) {
+inline std::string s(const Node &n, const std::string &k, std::optional<std::string> d = std::nullopt) {
 	return get<std::string>(n, k, "string", d);
 }
 
-inline std::vector<bool> bs(const YAML::Node &n, const std::string &k) {
+inline std::vector<bool> bs(const Node &n, const std::string &k) {
 	return get<std::vector<bool>>(n, k, "bool[]");
 }
 
 inline std::vector<uint32_t> us(
-	const YAML::Node &n,
+	const Node &n,
 	const std::string &k,
 	std::optional<std::vector<std::uint32_t>> d = std::nullopt
 ) {
@@ -68,7 +71,7 @@ inline std::vector<uint32_t> us(
 }
 
 inline std::vector<std::string> ss(
-	const YAML::Node &n,
+	const Node &n,
 	const std::string &k,
 	std::optional<std::vector<std::string>> d = std::nullopt
 ) {
@@ -76,7 +79,7 @@ inline std::vector<std::string> ss(
 }
 
 inline std::unordered_set<std::string> sus(
-	const YAML::Node &n,
+	const Node &n,
 	const std::string &k,
 	std::optional<std::unordered_set<std::string>> d = std::nullopt
 ) {
@@ -99,7 +102,7 @@ inline std::unordered_set<std::string> sus(
 }
 
 template<typename T>
-std::vector<T> parseConfigs(const YAML::Node &node, const std::string &k) {
+std::vector<T> parseConfigs(const Node &node, const std::string &k) {
 	std::vector<T> results;
 	for (const auto &n: node[k]) {
 		results.emplace_back(n);
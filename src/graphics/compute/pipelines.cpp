@@ -6,6 +6,7 @@
 #include "../../error/error.hpp"
 #include "../core/core.hpp"
 #include "../resource/descpool.hpp"
+#include "../utils.hpp"
 
 #include <unordered_map>
 
@@ -44,16 +45,10 @@ void initializeComputePipelines() {
 		ids.emplace_back(id);
 
 		// シェーダモジュール
-		const auto aid = error::at(config::config().assetMap, n.shader, "assets");
+		const auto aid = asset::getAssetId(n.shader);
 		const auto raw = asset::getAsset(aid);
-		const auto code = std::vector<uint32_t>(
-			reinterpret_cast<const uint32_t *>(raw.data()),
-			reinterpret_cast<const uint32_t *>(raw.data() + raw.size())
-		);
-		const auto shaderCi = vk::ShaderModuleCreateInfo()
-			.setCode(code);
-		auto shader = core::device().createShaderModuleUnique(shaderCi);
-		shaders.push_back(std::move(shader));
+		shaders.push_back(createShaderModule(raw.data(), raw.size()));
+		asset::release(aid);
 
 		// シェーダステージ
 		shaderStages.push_back(
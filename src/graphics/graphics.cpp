@@ -10,6 +10,7 @@
 #include "resource/image-user.hpp"
 #include "resource/mesh.hpp"
 #include "resource/sampler.hpp"
+#include "resource/sprite-atlas.hpp"
 #include "text/text.hpp"
 #include "window/swapchain.hpp"
 #include "utils.hpp"
@@ -37,6 +38,7 @@ void terminate() noexcept {
 	resource::destroyAllSamplers();
 	resource::destroyAllMeshes();
 	resource::destroyAllUserImages();
+	resource::destroyAllAtlases();
 	resource::destroyAllAttachmentImages();
 	resource::destroyDescriptorPool();
 	resource::destroyAllBuffers();
@@ -20,12 +20,15 @@ void createGraphicsPipeline(
 	const auto &device = core::device();
 
 	// シェーダステージ
-	const auto vsAId = error::at(config::config().assetMap, n.vertexShader,   "assets");
-	const auto fsAId = error::at(config::config().assetMap, n.fragmentShader, "assets");
-	const auto vsRaw = asset::getAsset(vsAId);
-	const auto fsRaw = asset::getAsset(fsAId);
+	const auto vsId = asset::getAssetId(n.vertexShader);
+	const auto fsId = asset::getAssetId(n.fragmentShader);
+	const auto vsRaw = asset::getAsset(vsId);
 	const auto vs = createShaderModule(vsRaw.data(), vsRaw.size());
+	const auto fsRaw = asset::getAsset(fsId);
 	const auto fs = createShaderModule(fsRaw.data(), fsRaw.size());
+	// NOTE: シェーダモジュールの作成時にSPIR-Vは読み終えているので、.datのページは不要。
+	asset::release(vsId);
+	asset::release(fsId);
 	std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
 	shaderStages.reserve(2);
 	shaderStages.emplace_back(vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eVertex,   vs.get(), "main");
@@ -2,6 +2,7 @@
 
 #include "../../config/config.hpp"
 #include "../core/core.hpp"
+#include "../utils.hpp"
 #include "../window/swapchain.hpp"
 
 namespace graphics::renderpass {
@@ -44,14 +45,4 @@ inline vk::PipelineMultisampleStateCreateInfo createPipelineMultisampleStateCrea
 		.setRasterizationSamples(vk::SampleCountFlagBits::e1);
 }
 
-inline vk::UniqueShaderModule createShaderModule(const unsigned char *data, size_t length) {
-	const auto code = std::vector<uint32_t>(
-		reinterpret_cast<const uint32_t *>(data),
-		reinterpret_cast<const uint32_t *>(data + length)
-	);
-	const auto ci = vk::ShaderModuleCreateInfo()
-		.setCode(code);
-	return core::device().createShaderModuleUnique(ci);
-}
-
 } // namespace graphics::renderpass
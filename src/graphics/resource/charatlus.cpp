@@ -18,8 +18,8 @@ void freeBitmap(unsigned char *p) {
 
 stbtt_fontinfo createFontInfo(const std::string &id) {
 	const auto &file = config::config().fonts.at(id).file;
-	const auto assetId = error::at(config::config().assetMap, file, "assets");
-	const auto font = asset::getAsset(assetId);
+	const auto assetId = asset::getAssetId(file);
+	const auto font = asset::getPinnedAsset(assetId);
 	stbtt_fontinfo info;
 	if (stbtt_InitFont(&info, font.data(), 0)) {
 		return info;
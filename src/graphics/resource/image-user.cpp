@@ -1,9 +1,11 @@
 #include "image-user.hpp"
 
 #include "../../asset/asset.hpp"
-#include "../../config/config.hpp"
 #include "../../error/error.hpp"
+#include "../../loader/loader.hpp"
 
+#include <cstring>
+#include <imagedef.hpp>
 #include <memory>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -13,19 +15,71 @@ namespace graphics::resource {
 
 std::unordered_map<std::string, Image> g_userImages;
 
-void destroyAllUserImages() noexcept {
-	g_userImages.clear();
-}
+struct Pixels {
+	using stbi_ptr = std::unique_ptr<stbi_uc, decltype(&stbi_image_free)>;
 
-void addUserImageFromFile(const std::string &file) {
-	if (g_userImages.contains(file)) {
-		throw std::format("image '{}' already created.", file);
+	const uint32_t width;
+	const uint32_t height;
+	const uint32_t mipLevels;
+	const stbi_ptr decoded;                  // 実行時にデコードした場合のみ
+	const std::vector<unsigned char> buffer; // 圧縮されたアセットを展開した場合のみ
+	const unsigned char *const data;         // decoded・bufferの先頭またはアーカイブ内のテクセルを指す
+
+	Pixels(uint32_t width, uint32_t height, stbi_ptr decoded):
+		width(width),
+		height(height),
+		mipLevels(1),
+		decoded(std::move(decoded)),
+		buffer(),
+		data(this->decoded.get())
+	{}
+
+	Pixels(uint32_t width, uint32_t height, uint32_t mipLevels, std::vector<unsigned char> &&buffer, const unsigned char *data):
+		width(width),
+		height(height),
+		mipLevels(mipLevels),
+		decoded(nullptr, stbi_image_free),
+		buffer(std::move(buffer)),
+		data(data)
+	{}
+};
+
+// NOTE: assetzipで事前にデコードされた画像ならデコードせずにそのまま使う。
+//       無圧縮で格納されていればアーカイブ内のテクセルを直接指すことになる。
+std::shared_ptr<Pixels> createRawUserImage(
+	const std::string &file,
+	std::vector<unsigned char> &&buffer,
+	std::span<const unsigned char> data
+) {
+	RawImageHeader header;
+	std::memcpy(&header, data.data(), sizeof(RawImageHeader));
+	if (
+		header.version != RAW_IMAGE_VERSION
+			|| header.format != RawImageFormat::Rgba8Srgb
+			|| header.width == 0
+			|| header.height == 0
+			|| header.mipCount == 0
+			|| header.mipCount > calcFullMipCount(header.width, header.height)
+			|| data.size() - sizeof(RawImageHeader) < calcRawImageSize(header.width, header.height, header.mipCount)
+	) {
+		throw std::format("the raw image '{}' is invalid.", file);
 	}
+	const auto texels = data.data() + sizeof(RawImageHeader);
+	return std::make_shared<Pixels>(header.width, header.height, header.mipCount, std::move(buffer), texels);
+}
 
-	using stbi_ptr = std::unique_ptr<stbi_uc, decltype(&stbi_image_free)>;
+// NOTE: ワーカースレッドからも呼ばれるので、スレッドセーフであること。
+std::shared_ptr<Pixels> decodeUserImage(const std::string &file) {
+	std::vector<unsigned char> buffer;
+	const auto data = asset::loadAsset(asset::getAssetId(file), buffer);
 
-	const auto assetId = error::at(config::config().assetMap, file, "assets");
-	const auto data = asset::getAsset(assetId);
+	uint32_t magic = 0;
+	if (data.size() >= sizeof(RawImageHeader)) {
+		std::memcpy(&magic, data.data(), sizeof(magic));
+	}
+	if (magic == RAW_IMAGE_MAGIC) {
+		return createRawUserImage(file, std::move(buffer), data);
+	}
 
 	// NOTE: MSVCの警告を逃れるため。
 	const auto dataSize = static_cast<int>(static_cast<uint32_t>(data.size()));
@@ -33,7 +87,7 @@ void addUserImageFromFile(const std::string &file) {
 	int width = 0;
 	int height = 0;
 	int channelCount = 0;
-	const auto pixels = stbi_ptr(
+	auto pixels = Pixels::stbi_ptr(
 		stbi_load_from_memory(data.data(), dataSize, &width, &height, &channelCount, 0),
 		stbi_image_free
 	);
@@ -43,17 +97,48 @@ void addUserImageFromFile(const std::string &file) {
 	if (channelCount != 4) {
 		throw std::format("'{}' is not RGBA.", file);
 	}
+	return std::make_shared<Pixels>(static_cast<uint32_t>(width), static_cast<uint32_t>(height), std::move(pixels));
+}
 
+void addUserImage(const std::string &file, const Pixels &pixels) {
+	if (g_userImages.contains(file)) {
+		throw std::format("image '{}' already created.", file);
+	}
 	g_userImages.try_emplace(
 		file,
-		width,
-		height,
-		pixels.get(),
+		pixels.width,
+		pixels.height,
+		pixels.data,
 		vk::Format::eR8G8B8A8Srgb,
 		vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst,
 		vk::ImageAspectFlagBits::eColor,
-		4
+		4,
+		pixels.mipLevels
 	);
+	// NOTE: GPUへアップロードし終えたので、.datのページは不要。
+	asset::release(asset::getAssetId(file));
+}
+
+void destroyAllUserImages() noexcept {
+	g_userImages.clear();
+}
+
+void addUserImageFromFile(const std::string &file) {
+	if (g_userImages.contains(file)) {
+		throw std::format("image '{}' already created.", file);
+	}
+	addUserImage(file, *decodeUserImage(file));
+}
+
+uint64_t addUserImageFromFileAsync(const std::string &file) {
+	if (g_userImages.contains(file)) {
+		throw std::format("image '{}' already created.", file);
+	}
+	return loader::enqueue([file]() {
+		const auto pixels = decodeUserImage(file);
+		const auto cost = static_cast<size_t>(calcRawImageSize(pixels->width, pixels->height, pixels->mipLevels));
+		return std::make_pair(loader::Finalizer([file, pixels]() { addUserImage(file, *pixels); }), cost);
+	});
 }
 
 void destroyUserImage(const std::string &id) noexcept {
@@ -8,6 +8,11 @@ void destroyAllUserImages() noexcept;
 
 void addUserImageFromFile(const std::string &file);
 
+/// イメージのデコードをワーカースレッドで行い、アップロードを後のフレームで行う関数
+///
+/// ローダーのチケットを返す。
+uint64_t addUserImageFromFileAsync(const std::string &file);
+
 void destroyUserImage(const std::string &id) noexcept;
 
 const Image &getUserImage(const std::string &id);
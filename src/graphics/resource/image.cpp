@@ -5,12 +5,12 @@
 
 namespace graphics::resource {
 
-vk::Image createImage(uint32_t width, uint32_t height, vk::Format format, vk::ImageUsageFlags usage) {
+vk::Image createImage(uint32_t width, uint32_t height, vk::Format format, vk::ImageUsageFlags usage, uint32_t mipLevels) {
 	const auto ci = vk::ImageCreateInfo()
 		.setImageType(vk::ImageType::e2D)
 		.setFormat(format)
 		.setExtent(vk::Extent3D(width, height, 1))
-		.setMipLevels(1)
+		.setMipLevels(mipLevels)
 		.setArrayLayers(1)
 		.setSamples(vk::SampleCountFlagBits::e1)
 		.setTiling(vk::ImageTiling::eOptimal)
@@ -19,7 +19,12 @@ vk::Image createImage(uint32_t width, uint32_t height, vk::Format format, vk::Im
 	return core::device().createImage(ci);
 }
 
-vk::ImageView createImageView(const vk::Image &image, vk::Format format, vk::ImageAspectFlags aspect) {
+vk::ImageView createImageView(
+	const vk::Image &image,
+	vk::Format format,
+	vk::ImageAspectFlags aspect,
+	uint32_t mipLevels
+) {
 	const auto vci = vk::ImageViewCreateInfo(
 		vk::ImageViewCreateFlags(),
 		image,
@@ -31,7 +36,7 @@ vk::ImageView createImageView(const vk::Image &image, vk::Format format, vk::Ima
 			vk::ComponentSwizzle::eB,
 			vk::ComponentSwizzle::eA
 		),
-		vk::ImageSubresourceRange(aspect, 0, 1, 0, 1)
+		vk::ImageSubresourceRange(aspect, 0, mipLevels, 0, 1)
 	);
 	return core::device().createImageView(vci);
 }
@@ -44,7 +49,7 @@ Image::Image(
 ):
 	_image(image),
 	_memory(nullptr),
-	_view(createImageView(_image, format, aspect)),
+	_view(createImageView(_image, format, aspect, 1)),
 	_chCount(chCount)
 {}
 
@@ -55,15 +60,16 @@ Image::Image(
 	vk::Format format,
 	vk::ImageUsageFlags usage,
 	vk::ImageAspectFlags aspect,
-	uint32_t chCount
+	uint32_t chCount,
+	uint32_t mipLevels
 ):
-	_image(createImage(width, height, format, usage)),
+	_image(createImage(width, height, format, usage, mipLevels)),
 	_memory(allocateMemory(_image, vk::MemoryPropertyFlagBits::eDeviceLocal)),
-	_view(createImageView(_image, format, aspect)),
+	_view(createImageView(_image, format, aspect, mipLevels)),
 	_chCount(chCount)
 {
 	if (pixels) {
-		uploadImage(_image, width, height, chCount, 0, 0, pixels);
+		uploadImage(_image, width, height, chCount, 0, 0, pixels, mipLevels);
 	}
 }
 
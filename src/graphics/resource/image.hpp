@@ -20,6 +20,7 @@ public:
 		vk::ImageAspectFlags aspect,
 		uint32_t chCount
 	);
+	/// NOTE: mipLevelsが2以上の場合、pixelsにはレベル0から順に全レベルのテクセルが隙間なく並んでいること。
 	Image(
 		uint32_t width,
 		uint32_t height,
@@ -27,7 +28,8 @@ public:
 		vk::Format format,
 		vk::ImageUsageFlags usage,
 		vk::ImageAspectFlags aspect,
-		uint32_t chCount
+		uint32_t chCount,
+		uint32_t mipLevels = 1
 	);
 	virtual ~Image();
 
@@ -3,6 +3,7 @@
 #include "../../asset/asset.hpp"
 #include "../../config/config.hpp"
 #include "../../error/error.hpp"
+#include "../../loader/loader.hpp"
 #include "../core/core.hpp"
 #include "../utils.hpp"
 
@@ -10,29 +11,25 @@
 
 namespace graphics::resource {
 
-const std::span<const unsigned char> getVerticesData(const std::string &id) {
-	const auto vertices = error::at(config::config().meshes, id, "meshes").vertices;
-	const auto assetId = error::at(config::config().assetMap, vertices, "assets");
-	return asset::getAsset(assetId);
+MeshData::MeshData(const std::string &id) {
+	const auto &config = error::at(config::config().meshes, id, "meshes");
+	vertexAssetId = asset::getAssetId(config.vertices);
+	indexAssetId = asset::getAssetId(config.indices);
+	vertices = asset::loadAsset(vertexAssetId, vertexBuffer);
+	indices = asset::loadAsset(indexAssetId, indexBuffer);
 }
 
-const std::span<const unsigned char> getIndicesData(const std::string &id) {
-	const auto indices = error::at(config::config().meshes, id, "meshes").indices;
-	const auto assetId = error::at(config::config().assetMap, indices, "assets");
-	return asset::getAsset(assetId);
-}
-
-Mesh::Mesh(const std::string &id):
+Mesh::Mesh(const std::string &id, const MeshData &data):
 	_id(id),
-	_iCount(static_cast<uint32_t>(getIndicesData(id).size() / sizeof(uint32_t))),
+	_iCount(static_cast<uint32_t>(data.indices.size() / sizeof(uint32_t))),
 	_vb(core::device().createBufferUnique(
 		vk::BufferCreateInfo()
-			.setSize(static_cast<uint32_t>(getVerticesData(id).size()))
+			.setSize(static_cast<uint32_t>(data.vertices.size()))
 			.setUsage(vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferDst)
 	)),
 	_ib(core::device().createBufferUnique(
 		vk::BufferCreateInfo()
-			.setSize(static_cast<uint32_t>(getIndicesData(id).size()))
+			.setSize(static_cast<uint32_t>(data.indices.size()))
 			.setUsage(vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eTransferDst)
 	)),
 	_vbMemory(allocateMemory(_vb.get(), vk::MemoryPropertyFlagBits::eDeviceLocal)),
@@ -40,16 +37,20 @@ Mesh::Mesh(const std::string &id):
 {
 	uploadBuffer(
 		_vb.get(),
-		static_cast<const void *>(getVerticesData(id).data()),
-		getVerticesData(id).size(),
+		static_cast<const void *>(data.vertices.data()),
+		data.vertices.size(),
 		vk::PipelineStageFlagBits::eVertexShader
 	);
 	uploadBuffer(
 		_ib.get(),
-		static_cast<const void *>(getIndicesData(id).data()),
-		getIndicesData(id).size(),
+		static_cast<const void *>(data.indices.data()),
+		data.indices.size(),
 		vk::PipelineStageFlagBits::eVertexShader
 	);
+
+	// NOTE: GPUへアップロードし終えたので、.datのページは不要。
+	asset::release(data.vertexAssetId);
+	asset::release(data.indexAssetId);
 }
 
 std::unordered_map<std::string, Mesh> g_meshes;
@@ -62,7 +63,26 @@ void addMesh(const std::string &id) {
 	if (g_meshes.contains(id)) {
 		throw std::format("mesh '{}' already created.", id);
 	}
-	g_meshes.emplace(id, id);
+	g_meshes.try_emplace(id, id, MeshData(id));
+}
+
+uint64_t addMeshAsync(const std::string &id) {
+	if (g_meshes.contains(id)) {
+		throw std::format("mesh '{}' already created.", id);
+	}
+	return loader::enqueue([id]() {
+		const auto data = std::make_shared<const MeshData>(id);
+		const auto cost = data->vertices.size() + data->indices.size();
+		return std::make_pair(
+			loader::Finalizer([id, data]() {
+				if (g_meshes.contains(id)) {
+					throw std::format("mesh '{}' already created.", id);
+				}
+				g_meshes.try_emplace(id, id, *data);
+			}),
+			cost
+		);
+	});
 }
 
 void destroyMesh(const std::string &id) noexcept {
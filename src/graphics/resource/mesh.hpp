@@ -1,12 +1,32 @@
 #pragma once
 
+#include <span>
+#include <vector>
 #include <vulkan/vulkan.hpp>
 
 namespace graphics::resource {
 
+/// メッシュの頂点・インデックスデータ
+///
+/// 圧縮されたアセットの場合は展開されたデータを保持する。
+/// スレッドセーフに構築できる。
+struct MeshData {
+	uint32_t vertexAssetId;
+	uint32_t indexAssetId;
+	std::vector<unsigned char> vertexBuffer;
+	std::vector<unsigned char> indexBuffer;
+	std::span<const unsigned char> vertices;
+	std::span<const unsigned char> indices;
+
+	MeshData(const MeshData &) = delete;
+	MeshData &operator =(const MeshData &) = delete;
+
+	MeshData(const std::string &id);
+};
+
 class Mesh {
 private:
-	const std::string &_id;
+	const std::string _id;
 	const uint32_t _iCount;
 	const vk::UniqueBuffer _vb;
 	const vk::UniqueBuffer _ib;
@@ -18,7 +38,7 @@ public:
 	Mesh(const Mesh &) = delete;
 	Mesh &operator =(const Mesh &) = delete;
 
-	Mesh(const std::string &id);
+	Mesh(const std::string &id, const MeshData &data);
 
 	const std::string &id() const noexcept {
 		return _id;
@@ -39,6 +59,11 @@ void destroyAllMeshes() noexcept;
 
 void addMesh(const std::string &id);
 
+/// メッシュデータの取得をワーカースレッドで行い、アップロードを後のフレームで行う関数
+///
+/// ローダーのチケットを返す。
+uint64_t addMeshAsync(const std::string &id);
+
 void destroyMesh(const std::string &id) noexcept;
 
 const Mesh &getMesh(const std::string &id);
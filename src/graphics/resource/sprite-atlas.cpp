@@ -0,0 +1,65 @@
+#include "sprite-atlas.hpp"
+
+#include "../../asset/asset.hpp"
+#include "../../error/error.hpp"
+
+#include <atlasdef.hpp>
+#include <cstring>
+#include <format>
+#include <unordered_map>
+#include <vector>
+
+namespace graphics::resource {
+
+std::unordered_map<std::string, std::unordered_map<std::string, Sprite>> g_atlases;
+
+std::unordered_map<std::string, Sprite> loadAtlas(const std::string &atlas) {
+	std::vector<unsigned char> buffer;
+	const auto data = asset::loadAsset(asset::getAssetId(atlas), buffer);
+
+	AtlasHeader header;
+	if (data.size() < sizeof(AtlasHeader)) {
+		throw std::format("the atlas '{}' is invalid.", atlas);
+	}
+	std::memcpy(&header, data.data(), sizeof(AtlasHeader));
+	// NOTE: 壊れた表でも桁あふれしないよう、残りのサイズから順に引いて確かめる。
+	const auto spritesSize = sizeof(AtlasSprite) * static_cast<uint64_t>(header.spriteCount);
+	const auto rest = static_cast<uint64_t>(data.size() - sizeof(AtlasHeader));
+	if (
+		header.magic != ATLAS_MAGIC
+			|| header.version != ATLAS_VERSION
+			|| rest < spritesSize
+			|| rest - spritesSize < header.stringSize
+	) {
+		throw std::format("the atlas '{}' is invalid.", atlas);
+	}
+
+	const auto strings = reinterpret_cast<const char *>(data.data() + sizeof(AtlasHeader) + spritesSize);
+	std::unordered_map<std::string, Sprite> sprites;
+	sprites.reserve(header.spriteCount);
+	for (uint32_t i = 0; i < header.spriteCount; ++i) {
+		AtlasSprite s;
+		std::memcpy(&s, data.data() + sizeof(AtlasHeader) + sizeof(AtlasSprite) * i, sizeof(AtlasSprite));
+		if (static_cast<uint64_t>(s.nameOffset) + s.nameLength > header.stringSize || s.page >= header.pageCount) {
+			throw std::format("the atlas '{}' is invalid.", atlas);
+		}
+		sprites.emplace(std::string(strings + s.nameOffset, s.nameLength), Sprite{s.page, {s.u0, s.v0, s.u1, s.v1}});
+	}
+	// NOTE: 表は複製し終えたので、.datのページは不要。
+	asset::release(asset::getAssetId(atlas));
+	return sprites;
+}
+
+void destroyAllAtlases() noexcept {
+	g_atlases.clear();
+}
+
+const Sprite &getSprite(const std::string &atlas, const std::string &file) {
+	auto it = g_atlases.find(atlas);
+	if (it == g_atlases.end()) {
+		it = g_atlases.emplace(atlas, loadAtlas(atlas)).first;
+	}
+	return error::at(it->second, file, std::format("the atlas '{}'", atlas));
+}
+
+} // namespace graphics::resource
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace graphics::resource {
+
+struct Sprite {
+	uint32_t page;            // イメージ"<アトラス名>.<page>"に含まれる
+	std::array<float, 4> uvs; // 左上のu, v, 右下のu, v
+};
+
+/// 読み込んだアトラスの表をすべて破棄する関数
+void destroyAllAtlases() noexcept;
+
+/// スプライトのアトラス上の位置を取得する関数
+///
+/// アトラスの表は初めて参照されたときに読み込まれる。
+const Sprite &getSprite(const std::string &atlas, const std::string &file);
+
+} // namespace graphics::resource
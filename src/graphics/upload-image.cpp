@@ -0,0 +1,95 @@
+#include "utils.hpp"
+
+namespace graphics {
+
+void uploadImage(
+	const vk::Image &dst,
+	uint32_t width,
+	uint32_t height,
+	uint32_t channels,
+	uint32_t offsetX,
+	uint32_t offsetY,
+	const uint8_t *src,
+	uint32_t mipLevels
+) {
+	const auto &device = core::device();
+	const auto subresRange = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, mipLevels, 0, 1);
+
+	// 各ミップレベルのコピー範囲
+	std::vector<vk::BufferImageCopy> regions;
+	vk::DeviceSize bufferSize = 0;
+	for (uint32_t i = 0; i < mipLevels; ++i) {
+		const auto w = std::max(width >> i, 1u);
+		const auto h = std::max(height >> i, 1u);
+		regions.push_back(
+			vk::BufferImageCopy()
+				.setBufferOffset(bufferSize)
+				.setImageSubresource(vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, i, 0, 1))
+				.setImageOffset(vk::Offset3D(offsetX, offsetY, 0))
+				.setImageExtent(vk::Extent3D(w, h, 1))
+		);
+		bufferSize += static_cast<vk::DeviceSize>(w) * h * channels;
+	}
+
+	// ステージングバッファ作成
+	const auto bci = vk::BufferCreateInfo()
+		.setSize(bufferSize)
+		.setUsage(vk::BufferUsageFlagBits::eTransferSrc)
+		.setSharingMode(vk::SharingMode::eExclusive);
+	const auto buffer = device.createBufferUnique(bci);
+	const auto bufferMemory = allocateMemory(buffer.get(), vk::MemoryPropertyFlagBits::eHostVisible);
+
+	// ステージングバッファへアップロード
+	copyDataToMemory(bufferMemory.get(), src, bufferSize);
+
+	// アップロード準備
+	const auto &commandBuffer = beginUtilityCommands();
+
+	// メモリバリア (undegined -> transferDstOptimal)
+	const auto bmb = vk::ImageMemoryBarrier(
+		vk::AccessFlags(),
+		vk::AccessFlagBits::eTransferWrite,
+		vk::ImageLayout::eUndefined,
+		vk::ImageLayout::eTransferDstOptimal,
+		vk::QueueFamilyIgnored,
+		vk::QueueFamilyIgnored,
+		dst,
+		subresRange
+	);
+	commandBuffer.pipelineBarrier(
+		vk::PipelineStageFlagBits::eAllCommands,
+		vk::PipelineStageFlagBits::eTransfer,
+		vk::DependencyFlags(),
+		{},
+		{},
+		{bmb}
+	);
+
+	// アップロード
+	commandBuffer.copyBufferToImage(buffer.get(), dst, vk::ImageLayout::eTransferDstOptimal, regions);
+
+	// メモリバリア (transferDstOptimal -> shaderReadOnlyOptimal)
+	const auto amb = vk::ImageMemoryBarrier(
+		vk::AccessFlagBits::eTransferWrite,
+		vk::AccessFlagBits::eShaderRead,
+		vk::ImageLayout::eTransferDstOptimal,
+		vk::ImageLayout::eShaderReadOnlyOptimal,
+		vk::QueueFamilyIgnored,
+		vk::QueueFamilyIgnored,
+		dst,
+		subresRange
+	);
+	commandBuffer.pipelineBarrier(
+		vk::PipelineStageFlagBits::eTransfer,
+		vk::PipelineStageFlagBits::eFragmentShader,
+		vk::DependencyFlags(),
+		{},
+		{},
+		{amb}
+	);
+
+	// アップロード提出
+	submitUtilityCommands("failed to wait for uploading an image.");
+}
+
+} // namespace graphics
@@ -68,8 +68,35 @@ inline void copyMemotyToData(T *dst, const vk::DeviceMemory &src, size_t size) {
 	device.unmapMemory(src);
 }
 
+/// SPIR-Vからシェーダモジュールを作成する関数
+///
+/// dataが4バイト境界に揃っている場合はコピーせずにそのまま渡す。
+inline vk::UniqueShaderModule createShaderModule(const unsigned char *data, size_t length) {
+	auto ci = vk::ShaderModuleCreateInfo().setCodeSize(length);
+	if (reinterpret_cast<uintptr_t>(data) % alignof(uint32_t) == 0) {
+		return core::device().createShaderModuleUnique(ci.setPCode(reinterpret_cast<const uint32_t *>(data)));
+	}
+	// NOTE: 埋め込まれたシェーダなど、境界に揃っていない場合はコピーする。
+	std::vector<uint32_t> code((length + 3) / 4);
+	memcpy(code.data(), data, length);
+	return core::device().createShaderModuleUnique(ci.setPCode(code.data()));
+}
+
+/// ユーティリティ用のコマンドバッファを記録し始める関数
+///
+/// 記録し終えたらsubmitUtilityCommands()で提出すること。
+const vk::CommandBuffer &beginUtilityCommands();
+
+/// ユーティリティ用のコマンドバッファを提出し、完了まで待機する関数
+///
+/// 待機に失敗した場合はerrorを投げる。
+void submitUtilityCommands(const char *error);
+
 void uploadBuffer(const vk::Buffer &dst, const void *src, size_t size, vk::PipelineStageFlags visibleStages);
 
+/// イメージへテクセルをアップロードする関数
+///
+/// mipLevelsが2以上の場合、srcにはレベル0から順に全レベルのテクセルが隙間なく並んでいること。
 void uploadImage(
 	const vk::Image &dst,
 	uint32_t width,
@@ -77,7 +104,8 @@ void uploadImage(
 	uint32_t channels,
 	uint32_t offsetX,
 	uint32_t offsetY,
-	const uint8_t *src
+	const uint8_t *src,
+	uint32_t mipLevels = 1
 );
 
 } // namespace graphics
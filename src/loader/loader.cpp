@@ -0,0 +1,150 @@
+#include "loader.hpp"
+
+#include "pool.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace loader {
+
+struct Job {
+	Task task;
+	Finalizer finalizer;
+	size_t cost;
+	std::exception_ptr exception;
+	bool decoded;  // g_mutexで保護
+	bool finished; // メインスレッドのみが参照
+};
+
+std::optional<Pool> g_pool;
+size_t g_uploadBudget;
+uint64_t g_nextTicket;
+std::unordered_map<uint64_t, std::shared_ptr<Job>> g_jobs;
+
+std::mutex g_mutex;
+std::condition_variable g_cv;
+std::deque<uint64_t> g_decoded;
+
+void initialize(size_t uploadBudget) {
+	if (g_pool) {
+		throw "loader already initialized.";
+	}
+	const auto threadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	g_pool.emplace(threadCount);
+	g_uploadBudget = uploadBudget;
+	g_nextTicket = 1;
+}
+
+void destroy() noexcept {
+	g_pool.reset();
+	g_jobs.clear();
+	g_decoded.clear();
+}
+
+uint64_t enqueue(Task task) {
+	if (!g_pool) {
+		throw "loader not initialized.";
+	}
+
+	const auto ticket = g_nextTicket++;
+	const auto job = std::make_shared<Job>(Job{std::move(task), nullptr, 0, nullptr, false, false});
+	g_jobs.emplace(ticket, job);
+
+	g_pool->submit([ticket, job]() {
+		Finalizer finalizer;
+		size_t cost = 0;
+		std::exception_ptr exception;
+		try {
+			std::tie(finalizer, cost) = job->task();
+		} catch (...) {
+			exception = std::current_exception();
+		}
+
+		std::lock_guard lock(g_mutex);
+		job->finalizer = std::move(finalizer);
+		job->cost = cost;
+		job->exception = exception;
+		job->decoded = true;
+		g_decoded.push_back(ticket);
+		g_cv.notify_all();
+	});
+
+	return ticket;
+}
+
+void finalize(Job &job) noexcept {
+	if (!job.exception && job.finalizer) {
+		try {
+			job.finalizer();
+		} catch (...) {
+			job.exception = std::current_exception();
+		}
+	}
+	job.task = nullptr;
+	job.finalizer = nullptr;
+	job.finished = true;
+}
+
+void update() {
+	// 後処理するジョブを選ぶ
+	std::vector<std::shared_ptr<Job>> jobs;
+	{
+		std::lock_guard lock(g_mutex);
+		size_t spent = 0;
+		while (!g_decoded.empty()) {
+			const auto it = g_jobs.find(g_decoded.front());
+			if (it == g_jobs.end()) {
+				g_decoded.pop_front();
+				continue;
+			}
+			if (!jobs.empty() && spent + it->second->cost > g_uploadBudget) {
+				break;
+			}
+			spent += it->second->cost;
+			jobs.push_back(it->second);
+			g_decoded.pop_front();
+		}
+	}
+
+	// 後処理
+	for (const auto &n: jobs) {
+		finalize(*n);
+	}
+}
+
+Status status(uint64_t ticket) {
+	const auto it = g_jobs.find(ticket);
+	if (it == g_jobs.end() || !it->second->finished) {
+		return Status::Pending;
+	}
+	return it->second->exception ? Status::Failed : Status::Succeeded;
+}
+
+void wait(uint64_t ticket) {
+	const auto it = g_jobs.find(ticket);
+	if (it == g_jobs.end()) {
+		throw std::format("the load ticket {} is invalid.", ticket);
+	}
+	const auto job = it->second;
+	g_jobs.erase(it);
+
+	if (!job->finished) {
+		{
+			std::unique_lock lock(g_mutex);
+			g_cv.wait(lock, [&job]() { return job->decoded; });
+			std::erase(g_decoded, ticket);
+		}
+		finalize(*job);
+	}
+
+	if (job->exception) {
+		std::rethrow_exception(job->exception);
+	}
+}
+
+} // namespace loader
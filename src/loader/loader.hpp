@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace loader {
+
+/// メインスレッドで実行される後処理 (GPUへのアップロードや登録など)
+using Finalizer = std::function<void()>;
+
+/// ワーカースレッドで実行されるデコード処理
+///
+/// 後処理とそのコスト (アップロードするバイト数など) を返す。
+/// スレッドセーフな処理のみを行うこと。
+using Task = std::function<std::pair<Finalizer, size_t>()>;
+
+/// ローダーを初期化する関数
+///
+/// - uploadBudget: 1フレームで実行する後処理のコストの上限
+void initialize(size_t uploadBudget);
+
+void destroy() noexcept;
+
+/// タスクをワーカースレッドに投入してチケットを返す関数
+uint64_t enqueue(Task task);
+
+/// デコードが完了したタスクの後処理を実行する関数
+///
+/// 毎フレーム呼ばれ、コストの合計が上限を超えない範囲で古いものから実行する。
+/// ただし、少なくとも1つは実行する。
+void update();
+
+enum class Status: uint8_t {
+	Pending = 0, // 処理中あるいは不明なチケット
+	Succeeded,
+	Failed,
+};
+
+/// チケットの処理がすべて完了しているか確認する関数
+///
+/// 完了していれば成否を返す。チケットは破棄しないので、最後にwait()を呼ぶこと。
+Status status(uint64_t ticket);
+
+/// チケットの処理がすべて完了するまで待機する関数
+///
+/// 後処理が済んでいなければこの場で実行する。
+/// 処理中に発生した例外はここで再送出される。
+/// 完了したチケットは破棄される。
+void wait(uint64_t ticket);
+
+} // namespace loader
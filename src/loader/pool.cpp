@@ -0,0 +1,48 @@
+#include "pool.hpp"
+
+namespace loader {
+
+Pool::Pool(uint32_t threadCount): _stopping(false) {
+	_threads.reserve(threadCount);
+	for (uint32_t i = 0; i < threadCount; ++i) {
+		_threads.emplace_back(&Pool::_run, this);
+	}
+}
+
+Pool::~Pool() {
+	{
+		std::lock_guard lock(_mutex);
+		_stopping = true;
+		_tasks.clear();
+	}
+	_cv.notify_all();
+	for (auto &n: _threads) {
+		n.join();
+	}
+}
+
+void Pool::_run() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock lock(_mutex);
+			_cv.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+			if (_stopping) {
+				return;
+			}
+			task = std::move(_tasks.front());
+			_tasks.pop_front();
+		}
+		task();
+	}
+}
+
+void Pool::submit(std::function<void()> task) {
+	{
+		std::lock_guard lock(_mutex);
+		_tasks.push_back(std::move(task));
+	}
+	_cv.notify_one();
+}
+
+} // namespace loader
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace loader {
+
+/// ワーカースレッドのプール
+///
+/// 破棄時にはまだ開始されていないタスクは捨てられ、実行中のタスクの完了を待つ。
+class Pool {
+private:
+	std::mutex _mutex;
+	std::condition_variable _cv;
+	std::deque<std::function<void()>> _tasks;
+	bool _stopping;
+	std::vector<std::thread> _threads;
+
+	void _run();
+
+public:
+	Pool() = delete;
+	Pool(const Pool &) = delete;
+	Pool &operator =(const Pool &) = delete;
+
+	Pool(uint32_t threadCount);
+	~Pool();
+
+	uint32_t threadCount() const noexcept {
+		return static_cast<uint32_t>(_threads.size());
+	}
+
+	void submit(std::function<void()> task);
+};
+
+} // namespace loader
@@ -0,0 +1,25 @@
+#include <orge.h>
+
+#include "asset/asset.hpp"
+
+uint64_t orgeGetAssetStatistic(uint32_t kind) {
+	const auto statistics = asset::statistics();
+	switch (static_cast<OrgeAssetStatistic>(kind)) {
+	case ORGE_ASSET_STATISTIC_ARCHIVE_SIZE:
+		return statistics.archiveSize;
+	case ORGE_ASSET_STATISTIC_CACHE_SIZE:
+		return statistics.cacheSize;
+	case ORGE_ASSET_STATISTIC_CACHE_HIT_COUNT:
+		return statistics.cacheHitCount;
+	case ORGE_ASSET_STATISTIC_CACHE_MISS_COUNT:
+		return statistics.cacheMissCount;
+	case ORGE_ASSET_STATISTIC_DECODED_SIZE:
+		return statistics.decodedSize;
+	case ORGE_ASSET_STATISTIC_DECODE_TIME:
+		return statistics.decodeTime;
+	case ORGE_ASSET_STATISTIC_RELEASED_SIZE:
+		return statistics.releasedSize;
+	default:
+		return 0;
+	}
+}
@@ -3,6 +3,38 @@
 #include "audio/audio.hpp"
 #include "orge-private.hpp"
 
+uint64_t orgeGetAudioStatistic(uint32_t kind) {
+	try {
+		const auto statistics = audio::audio().statistics();
+		switch (static_cast<OrgeAudioStatistic>(kind)) {
+		case ORGE_AUDIO_STATISTIC_RESIDENT_SIZE:
+			return statistics.residentSize;
+		case ORGE_AUDIO_STATISTIC_EVICTION_COUNT:
+			return statistics.evictionCount;
+		case ORGE_AUDIO_STATISTIC_RELOAD_COUNT:
+			return statistics.reloadCount;
+		case ORGE_AUDIO_STATISTIC_QUEUED_SIZE:
+			return statistics.queuedSize;
+		case ORGE_AUDIO_STATISTIC_MIX_OVERRUN_COUNT:
+			return statistics.mixOverrunCount;
+		case ORGE_AUDIO_STATISTIC_CALLBACK_GAP_COUNT:
+			return statistics.callbackGapCount;
+		case ORGE_AUDIO_STATISTIC_MIX_TIME:
+			return statistics.mixTime;
+		case ORGE_AUDIO_STATISTIC_DECODE_TIME:
+			return statistics.decodeTime;
+		case ORGE_AUDIO_STATISTIC_CONVERT_TIME:
+			return statistics.convertTime;
+		case ORGE_AUDIO_STATISTIC_LATENCY:
+			return statistics.latency;
+		default:
+			return 0;
+		}
+	} catch (...) {
+		return 0;
+	}
+}
+
 float orgeGetAudioChannelVolume(uint32_t index) {
 	try {
 		return audio::audio().getVolume(index);
@@ -19,10 +51,40 @@ uint8_t orgeLoadWave(const char *file, uint32_t startPosition) {
 	TRY(audio::audio().loadWaveFromFile(file, startPosition));
 }
 
+void loadWaves(const char *const *files, const uint32_t *startPositions, uint32_t count) {
+	const std::vector<std::string> fileVector(files, files + count);
+	const auto startPositionVector = startPositions
+		? std::vector<uint32_t>(startPositions, startPositions + count)
+		: std::vector<uint32_t>(count, 0);
+	audio::audio().loadWavesFromFiles(fileVector, startPositionVector);
+}
+
+uint8_t orgeLoadWaves(const char *const *files, const uint32_t *startPositions, uint32_t count) {
+	TRY(loadWaves(files, startPositions, count));
+}
+
 void orgeDestroyWave(const char *file) {
 	audio::audio().destroyWave(file);
 }
 
+uint64_t orgeGetWaveDecodeTime(const char *file) {
+	try {
+		return audio::audio().getDecodeTime(file);
+	} catch (...) {
+		return 0;
+	}
+}
+
 uint8_t orgePlayWave(const char *file, uint32_t index, uint8_t loop) {
 	TRY(audio::audio().play(file, index, static_cast<bool>(loop)));
 }
+
+uint64_t orgePlaySound(const char *file, float volume) {
+	uint64_t handle = 0;
+	TRY_DISCARD(handle = audio::audio().playSound(file, volume));
+	return handle;
+}
+
+void orgeStopSound(uint64_t handle) {
+	audio::audio().stopSound(handle);
+}
@@ -0,0 +1,32 @@
+#include <orge.h>
+
+#include "audio/audio.hpp"
+#include "graphics/resource/image-user.hpp"
+#include "graphics/resource/mesh.hpp"
+#include "loader/loader.hpp"
+#include "orge-private.hpp"
+
+#define TRY_TICKET(n) \
+	uint64_t ticket = 0; \
+	TRY_DISCARD(ticket = (n)); \
+	return ticket;
+
+uint64_t orgeLoadImageAsync(const char *file) {
+	TRY_TICKET(graphics::resource::addUserImageFromFileAsync(file));
+}
+
+uint64_t orgeLoadMeshAsync(const char *id) {
+	TRY_TICKET(graphics::resource::addMeshAsync(id));
+}
+
+uint64_t orgeLoadWaveAsync(const char *file, uint32_t startPosition) {
+	TRY_TICKET(audio::audio().loadWaveFromFileAsync(file, startPosition));
+}
+
+uint8_t orgeIsLoaded(uint64_t ticket) {
+	return static_cast<uint8_t>(loader::status(ticket));
+}
+
+uint8_t orgeWaitLoaded(uint64_t ticket) {
+	TRY(loader::wait(ticket));
+}
@@ -0,0 +1,14 @@
+#include <orge.h>
+
+#include "graphics/resource/sprite-atlas.hpp"
+#include "orge-private.hpp"
+
+#include <algorithm>
+
+uint8_t orgeGetSprite(const char *atlas, const char *file, uint32_t *page, float *uvs) {
+	TRY(
+		const auto &sprite = graphics::resource::getSprite(atlas, file);
+		*page = sprite.page;
+		std::copy(sprite.uvs.begin(), sprite.uvs.end(), uvs);
+	);
+}
@@ -8,6 +8,7 @@
 #include "graphics/graphics.hpp"
 #include "graphics/window/swapchain.hpp"
 #include "input/input.hpp"
+#include "loader/loader.hpp"
 #include "orge-private.hpp"
 
 #include <cstdlib>
@@ -57,6 +58,14 @@ uint8_t orgeInitialize(void) {
 		}
 		asset::initialize();
 		config::initialize();
+		asset::setCacheCapacity(static_cast<size_t>(config::config().assetCacheSize) << 20);
+		if (config::config().eagerAssetVerification) {
+			asset::verifyAllInBackground();
+		}
+		if (!config::config().assetTrace.empty()) {
+			asset::startTrace(config::config().assetTrace);
+		}
+		loader::initialize(static_cast<size_t>(config::config().asyncUploadBudget) << 10);
 		graphics::initialize();
 		audio::initialize();
 		input::initialize();
@@ -64,9 +73,11 @@ uint8_t orgeInitialize(void) {
 }
 
 void orgeTerminate(void) {
+	loader::destroy();
 	graphics::terminate();
 	audio::destroy();
 	input::destroy();
+	asset::terminate();
 }
 
 uint8_t orgeUpdate(void) {
@@ -87,8 +98,8 @@ uint8_t orgeUpdate(void) {
 			swapchain.setFullscreen(!swapchain.isFullscreen());
 		}
 	}
-	// TODO: 例外どうしよう。
-	audio::audio().update();
 	input::input().update();
+	loader::update();
+	asset::update();
 	return 1;
 }